@@ -0,0 +1,2992 @@
+// GENERATED CODE!
+// GENERATED CODE!
+// GENERATED CODE!
+//
+// This code *might* be derived from a copyrighted source. Proceed with
+// caution!
+
+// Needed by `Jump.h`. See that file for further info.
+#define _XOPEN_SOURCE 700
+
+#include "type/Bool.h"
+#include "type/Box.h"
+#include "type/Builtin.h"
+#include "type/Class.h"
+#include "type/Cmp.h"
+#include "type/If.h"
+#include "type/Int.h"
+#include "type/Jump.h"
+#include "type/List.h"
+#include "type/Map.h"
+#include "type/Null.h"
+#include "type/Object.h"
+#include "type/Record.h"
+#include "type/String.h"
+#include "type/Symbol.h"
+#include "type/SymbolTable.h"
+#include "type/define.h"
+#include "util.h"
+
+/** Global environment originally passed into `eval`. */
+static zvalue GLOBALS = NULL;
+
+
+//
+// Literal values
+//
+
+static zvalue LIT_0 = NULL;
+static zvalue LIT_1 = NULL;
+static zvalue LIT_2 = NULL;
+static zvalue LIT_3 = NULL;
+static zvalue LIT_4 = NULL;
+static zvalue LIT_5 = NULL;
+static zvalue LIT_6 = NULL;
+static zvalue LIT_7 = NULL;
+static zvalue LIT_8 = NULL;
+static zvalue LIT_9 = NULL;
+static zvalue LIT_10 = NULL;
+static zvalue LIT_11 = NULL;
+static zvalue LIT_12 = NULL;
+static zvalue LIT_13 = NULL;
+static zvalue LIT_14 = NULL;
+static zvalue LIT_15 = NULL;
+static zvalue LIT_16 = NULL;
+static zvalue LIT_17 = NULL;
+static zvalue LIT_18 = NULL;
+static zvalue LIT_19 = NULL;
+static zvalue LIT_20 = NULL;
+static zvalue LIT_21 = NULL;
+static zvalue LIT_22 = NULL;
+static zvalue LIT_23 = NULL;
+static zvalue LIT_24 = NULL;
+static zvalue LIT_25 = NULL;
+static zvalue LIT_26 = NULL;
+static zvalue LIT_27 = NULL;
+static zvalue LIT_28 = NULL;
+static zvalue LIT_29 = NULL;
+static zvalue LIT_30 = NULL;
+static zvalue LIT_31 = NULL;
+static zvalue LIT_32 = NULL;
+static zvalue LIT_33 = NULL;
+static zvalue LIT_34 = NULL;
+static zvalue LIT_35 = NULL;
+static zvalue LIT_36 = NULL;
+static zvalue LIT_37 = NULL;
+static zvalue LIT_38 = NULL;
+static zvalue LIT_39 = NULL;
+static zvalue LIT_40 = NULL;
+static zvalue LIT_41 = NULL;
+static zvalue LIT_42 = NULL;
+static zvalue LIT_43 = NULL;
+static zvalue LIT_44 = NULL;
+static zvalue LIT_45 = NULL;
+static zvalue LIT_46 = NULL;
+static zvalue LIT_47 = NULL;
+static zvalue LIT_48 = NULL;
+static zvalue LIT_49 = NULL;
+static zvalue LIT_50 = NULL;
+static zvalue LIT_51 = NULL;
+static zvalue LIT_52 = NULL;
+static zvalue LIT_53 = NULL;
+static zvalue LIT_54 = NULL;
+static zvalue LIT_55 = NULL;
+static zvalue LIT_56 = NULL;
+static zvalue LIT_57 = NULL;
+static zvalue LIT_58 = NULL;
+static zvalue LIT_59 = NULL;
+static zvalue LIT_60 = NULL;
+static zvalue LIT_61 = NULL;
+static zvalue LIT_62 = NULL;
+static zvalue LIT_63 = NULL;
+static zvalue LIT_64 = NULL;
+static zvalue LIT_65 = NULL;
+static zvalue LIT_66 = NULL;
+static zvalue LIT_67 = NULL;
+static zvalue LIT_68 = NULL;
+static zvalue LIT_69 = NULL;
+static zvalue LIT_70 = NULL;
+static zvalue LIT_71 = NULL;
+static zvalue LIT_72 = NULL;
+static zvalue LIT_73 = NULL;
+
+static void initLiterals(zvalue env) {
+    datImmortalize(LIT_0 = CLS_Cmp);
+    datImmortalize(LIT_1 = symbolFromUtf8(5, "perEq"));
+    datImmortalize(LIT_2 = symbolFromUtf8(3, "get"));
+    datImmortalize(LIT_3 = symbolFromUtf8(6, "source"));
+    datImmortalize(LIT_4 = symbolFromUtf8(4, "call"));
+    datImmortalize(LIT_5 = symbolFromUtf8(5, "probe"));
+    datImmortalize(LIT_6 = INT_1);
+    datImmortalize(LIT_7 = stringFromUtf8(16, "@<Closure probe>"));
+    datImmortalize(LIT_8 = CLS_If);
+    datImmortalize(LIT_9 = symbolFromUtf8(5, "value"));
+    datImmortalize(LIT_10 = intFromZint(100000));
+    datImmortalize(LIT_11 = intFromZint(1000));
+    datImmortalize(LIT_12 = symbolFromUtf8(6, "expect"));
+    datImmortalize(LIT_13 = symbolFromUtf8(5, "perNe"));
+    datImmortalize(LIT_14 = stringFromUtf8(19, "Unexpected result: "));
+    datImmortalize(LIT_15 = stringFromUtf8(5, "For: "));
+    datImmortalize(LIT_16 = stringFromUtf8(23, "Unexpected void result."));
+    datImmortalize(LIT_17 = symbolFromUtf8(10, "expectVoid"));
+    datImmortalize(
+      LIT_18 = stringFromUtf8(28, "Unexpected non-void result: "));
+
+    datImmortalize(LIT_19 = symbolFromUtf8(9, "countDown"));
+    datImmortalize(LIT_20 = INT_0);
+    datImmortalize(LIT_21 = stringFromUtf8(4, "done"));
+    datImmortalize(LIT_22 = symbolFromUtf8(3, "sub"));
+    datImmortalize(LIT_23 = symbolFromUtf8(6, "isEven"));
+    datImmortalize(LIT_24 = BOOL_TRUE);
+    datImmortalize(LIT_25 = symbolFromUtf8(5, "isOdd"));
+    datImmortalize(LIT_26 = BOOL_FALSE);
+    datImmortalize(LIT_27 = symbolFromUtf8(7, "descend"));
+    datImmortalize(LIT_28 = stringFromUtf8(6, "bottom"));
+    datImmortalize(LIT_29 = stringFromUtf8(14, "Exit returned."));
+    datImmortalize(LIT_30 = symbolFromUtf8(11, "descendFrom"));
+    datImmortalize(LIT_31 = symbolFromUtf8(17, "countDownWithExit"));
+    datImmortalize(LIT_32 = stringFromUtf8(6, "exited"));
+    datImmortalize(LIT_33 = symbolFromUtf8(9, "maybeVoid"));
+    datImmortalize(LIT_34 = symbolFromUtf8(10, "maybeValue"));
+    datImmortalize(LIT_35 = symbolFromUtf8(18, "maybeVoidThenValue"));
+    datImmortalize(LIT_36 = THE_NULL);
+    datImmortalize(LIT_37 = symbolFromUtf8(5, "stash"));
+    datImmortalize(LIT_38 = stringFromUtf8(7, "stashed"));
+    datImmortalize(LIT_39 = symbolFromUtf8(3, "add"));
+    datImmortalize(LIT_40 = stringFromUtf8(13, "Fell through."));
+    datImmortalize(
+      LIT_41 = stringFromUtf8(33, "Out-of-scope exit (should die)..."));
+
+    datImmortalize(LIT_42 = stringFromUtf8(5, "stash"));
+    datImmortalize(LIT_43 = stringFromUtf8(4, "late"));
+    datImmortalize(LIT_44 = stringFromUtf8(27, "Out-of-scope exit returned."));
+
+    datImmortalize(LIT_45 = symbolFromUtf8(4, "main"));
+    datImmortalize(LIT_46 = stringFromUtf8(18, "Deep tail calls..."));
+    datImmortalize(LIT_47 = stringFromUtf8(9, "countDown"));
+    datImmortalize(LIT_48 = stringFromUtf8(6, "isEven"));
+    datImmortalize(LIT_49 = stringFromUtf8(5, "isOdd"));
+    datImmortalize(LIT_50 = stringFromUtf8(27, "Exits through tail calls..."));
+
+    datImmortalize(LIT_51 = stringFromUtf8(13, "descend inner"));
+    datImmortalize(LIT_52 = stringFromUtf8(12, "descend tail"));
+    datImmortalize(LIT_53 = stringFromUtf8(11, "descendFrom"));
+    datImmortalize(LIT_54 = stringFromUtf8(17, "countDownWithExit"));
+    datImmortalize(
+      LIT_55 = stringFromUtf8(34, "Maybe yields through tail calls..."));
+
+    datImmortalize(LIT_56 = stringFromUtf8(9, "maybeVoid"));
+    datImmortalize(LIT_57 = stringFromUtf8(10, "maybeValue"));
+    datImmortalize(
+      LIT_58 =
+        methCall(
+          CLS_List,
+          SYM(new),
+          (zarray) {1,
+          (zvalue[]) {
+            stringFromUtf8(12, "out-of-scope")}}));
+
+    datImmortalize(
+      LIT_59 =
+        methCall(
+          CLS_List,
+          SYM(new),
+          (zarray) {1,
+          (zvalue[]) {
+            stringFromUtf8(10, "void-value")}}));
+
+    datImmortalize(
+      LIT_60 =
+        stringFromUtf8(46, "Void where a value is required (should die)..."));
+
+    datImmortalize(LIT_61 = stringFromUtf8(20, "Void value accepted."));
+    datImmortalize(LIT_62 = stringFromUtf8(9, "All good."));
+    datImmortalize(LIT_63 = CLS_Record);
+    datImmortalize(LIT_64 = symbolFromUtf8(3, "new"));
+    datImmortalize(LIT_65 = symbolFromUtf8(6, "module"));
+    datImmortalize(LIT_66 = CLS_SymbolTable);
+    datImmortalize(LIT_67 = symbolFromUtf8(7, "exports"));
+    datImmortalize(LIT_68 = symbolFromUtf8(4, "info"));
+    datImmortalize(
+      LIT_69 =
+        methCall(
+          CLS_SymbolTable,
+          SYM(new),
+          (zarray) {6,
+          (zvalue[]) {
+            symbolFromUtf8(7, "exports"),
+            methCall(
+              CLS_Map,
+              SYM(new),
+              (zarray) {2,
+              (zvalue[]) {
+                symbolFromUtf8(4, "main"),
+                CLS_Value}}),
+            symbolFromUtf8(7, "imports"),
+            EMPTY_MAP,
+            symbolFromUtf8(9, "resources"),
+            EMPTY_MAP}}));
+
+    datImmortalize(LIT_70 = symbolFromUtf8(7, "$Format"));
+    datImmortalize(LIT_71 = symbolFromUtf8(2, "If"));
+    datImmortalize(LIT_72 = symbolFromUtf8(3, "die"));
+    datImmortalize(LIT_73 = symbolFromUtf8(4, "note"));
+}
+
+
+//
+// Closure definitions
+//
+
+/* @probe */ static zvalue makeClosure_0();
+static zvalue makeClosure_1(/* @INTERPRETED */ zvalue free_0_INTERPRETED);
+static zvalue makeClosure_2();
+static zvalue makeClosure_3();
+static zvalue makeClosure_4(/* @func */ zvalue free_0_func);
+static zvalue makeClosure_5(
+  /* @got */ zvalue free_0_got,
+  /* @result */ zvalue free_1_result);
+
+static zvalue makeClosure_6(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @got */ zvalue free_2_got,
+  /* @name */ zvalue free_3_name,
+  /* @note */ zvalue free_4_note);
+
+static zvalue makeClosure_7(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @name */ zvalue free_2_name,
+  /* @note */ zvalue free_3_note,
+  /* @result */ zvalue free_4_result);
+
+static zvalue makeClosure_8(
+  /* @die */ zvalue free_0_die,
+  /* @name */ zvalue free_1_name,
+  /* @note */ zvalue free_2_note);
+
+// @expect
+static zvalue makeClosure_9(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note);
+
+static zvalue makeClosure_10(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @name */ zvalue free_2_name,
+  /* @note */ zvalue free_3_note);
+
+// @expectVoid
+static zvalue makeClosure_11(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note);
+
+static zvalue makeClosure_12(/* @n */ zvalue free_0_n);
+static zvalue makeClosure_13(/* @return */ zvalue free_0_return);
+// @countDown
+static zvalue makeClosure_14(/* @countDown */ zvalue free_0_countDown);
+
+static zvalue makeClosure_15(/* @return */ zvalue free_0_return);
+/* @isEven */ static zvalue makeClosure_16(/* @isOdd */ zvalue free_0_isOdd);
+static zvalue makeClosure_17(/* @return */ zvalue free_0_return);
+/* @isOdd */ static zvalue makeClosure_18(/* @isEven */ zvalue free_0_isEven);
+static zvalue makeClosure_19(
+  /* @die */ zvalue free_0_die,
+  /* @exit */ zvalue free_1_exit);
+
+// @descend
+static zvalue makeClosure_20(
+  /* @descend */ zvalue free_0_descend,
+  /* @die */ zvalue free_1_die);
+
+static zvalue makeClosure_21(/* @return */ zvalue free_0_return);
+// @descendFrom
+static zvalue makeClosure_22(/* @descend */ zvalue free_0_descend);
+
+static zvalue makeClosure_23(
+  /* @die */ zvalue free_0_die,
+  /* @return */ zvalue free_1_return);
+
+// @countDownWithExit
+static zvalue makeClosure_24(
+  /* @countDownWithExit */ zvalue free_0_countDownWithExit,
+  /* @die */ zvalue free_1_die);
+
+static zvalue makeClosure_25(/* @return */ zvalue free_0_return);
+// @maybeVoid
+static zvalue makeClosure_26(/* @maybeVoid */ zvalue free_0_maybeVoid);
+
+static zvalue makeClosure_27(/* @return */ zvalue free_0_return);
+// @maybeValue
+static zvalue makeClosure_28(/* @maybeValue */ zvalue free_0_maybeValue);
+
+// @maybeVoidThenValue
+static zvalue makeClosure_29(/* @maybeVoid */ zvalue free_0_maybeVoid);
+
+// @stash
+static zvalue makeClosure_30(/* @stashed */ zvalue free_0_stashed);
+
+static zvalue makeClosure_31(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @countDown */ zvalue free_1_countDown);
+
+static zvalue makeClosure_32(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @isEven */ zvalue free_1_isEven);
+
+static zvalue makeClosure_33(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @isOdd */ zvalue free_1_isOdd);
+
+static zvalue makeClosure_34(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend,
+  /* @die */ zvalue free_2_die);
+
+static zvalue makeClosure_35(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend,
+  /* @die */ zvalue free_2_die);
+
+static zvalue makeClosure_36(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend);
+
+static zvalue makeClosure_37(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend);
+
+static zvalue makeClosure_38(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descendFrom */ zvalue free_1_descendFrom);
+
+static zvalue makeClosure_39(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @countDownWithExit */ zvalue free_1_countDownWithExit);
+
+static zvalue makeClosure_40(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @maybeVoid */ zvalue free_1_maybeVoid);
+
+static zvalue makeClosure_41(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @maybeValue */ zvalue free_1_maybeValue);
+
+static zvalue makeClosure_42(/* @stash */ zvalue free_0_stash);
+static zvalue makeClosure_43(
+  /* @die */ zvalue free_0_die,
+  /* @expect */ zvalue free_1_expect,
+  /* @note */ zvalue free_2_note,
+  /* @stash */ zvalue free_3_stash,
+  /* @stashed */ zvalue free_4_stashed);
+
+static zvalue makeClosure_44(/* @args */ zvalue free_0_args);
+static zvalue makeClosure_45(/* @args */ zvalue free_0_args);
+static zvalue makeClosure_46(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @die */ zvalue free_1_die,
+  /* @maybeVoidThenValue */ zvalue free_2_maybeVoidThenValue,
+  /* @note */ zvalue free_3_note);
+
+static zvalue makeClosure_47(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @args */ zvalue free_1_args,
+  /* @die */ zvalue free_2_die,
+  /* @maybeVoidThenValue */ zvalue free_3_maybeVoidThenValue,
+  /* @note */ zvalue free_4_note);
+
+// @main
+static zvalue makeClosure_48(
+  /* @"<closure 18>" */ zvalue free_0__closure_18_,
+  /* @"<closure 19>" */ zvalue free_1__closure_19_,
+  /* @"<closure 20>" */ zvalue free_2__closure_20_,
+  /* @"<closure 21>" */ zvalue free_3__closure_21_,
+  /* @"<closure 22>" */ zvalue free_4__closure_22_,
+  /* @"<closure 23>" */ zvalue free_5__closure_23_,
+  /* @"<closure 24>" */ zvalue free_6__closure_24_,
+  /* @"<closure 25>" */ zvalue free_7__closure_25_,
+  /* @"<closure 26>" */ zvalue free_8__closure_26_,
+  /* @"<closure 28>" */ zvalue free_9__closure_28_,
+  /* @DEPTH */ zvalue free_10_DEPTH,
+  /* @die */ zvalue free_11_die,
+  /* @expect */ zvalue free_12_expect,
+  /* @expectVoid */ zvalue free_13_expectVoid,
+  /* @maybeVoidThenValue */ zvalue free_14_maybeVoidThenValue,
+  /* @note */ zvalue free_15_note);
+
+static zvalue makeClosure_49(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note);
+
+
+/* @probe */
+static FUN_IMPL_DECL(0) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  return datNonVoid(LIT_6);
+}
+
+static FUN_IMPL_DECL(1) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "INTERPRETED" */ zvalue free_0_INTERPRETED = state[0];
+  return
+    methCall(datNonVoid(free_0_INTERPRETED), SYM(fetch), (zarray) {0, NULL});
+
+}
+
+static FUN_IMPL_DECL(2) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  return datNonVoid(LIT_10);
+}
+
+static FUN_IMPL_DECL(3) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  return datNonVoid(LIT_11);
+}
+
+static FUN_IMPL_DECL(4) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "func" */ zvalue free_0_func = state[0];
+  return
+    methCall(
+      methCall(datNonVoid(free_0_func), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {0,
+      NULL});
+
+}
+
+static FUN_IMPL_DECL(5) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "got" */ zvalue free_0_got = state[0];
+  /* "result" */ zvalue free_1_result = state[1];
+  return
+    methCall(
+      LIT_0,
+      LIT_13,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_got), SYM(fetch), (zarray) {0, NULL})),
+        datNonVoid(
+          methCall(datNonVoid(free_1_result), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(6) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  /* "got" */ zvalue free_2_got = state[2];
+  /* "name" */ zvalue free_3_name = state[3];
+  /* "note" */ zvalue free_4_note = state[4];
+  methCall(
+    methCall(datNonVoid(free_4_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(LIT_14),
+      datNonVoid(
+        methCall(
+          methCall(
+            methCall(
+              datNonVoid(free_0__Format),
+              SYM(fetch),
+              (zarray) {0,
+              NULL}),
+            LIT_2,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_3)}}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(
+              methCall(datNonVoid(free_2_got), SYM(fetch), (zarray) {0, NULL}))}}))}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_1_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(LIT_15),
+        datNonVoid(
+          methCall(datNonVoid(free_3_name), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(7) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "got"
+  zvalue arg_0_got =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  /* "name" */ zvalue free_2_name = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  /* "result" */ zvalue free_4_result = state[4];
+  // @"<closure 2>"
+  zvalue local_6__closure_2_ =
+    cm_newBox(Result, datNonVoid(makeClosure_5(arg_0_got, free_4_result)));
+
+  // @"<closure 3>"
+  zvalue local_7__closure_3_ =
+    cm_newBox(
+      Result,
+      datNonVoid(
+        makeClosure_6(
+          free_0__Format,
+          free_1_die,
+          arg_0_got,
+          free_2_name,
+          free_3_note)));
+
+  return
+    methCall(
+      LIT_8,
+      LIT_9,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(
+            datNonVoid(local_6__closure_2_),
+            SYM(fetch),
+            (zarray) {0,
+            NULL})),
+        datNonVoid(
+          methCall(
+            datNonVoid(local_7__closure_3_),
+            SYM(fetch),
+            (zarray) {0,
+            NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(8) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "die" */ zvalue free_0_die = state[0];
+  /* "name" */ zvalue free_1_name = state[1];
+  /* "note" */ zvalue free_2_note = state[2];
+  methCall(
+    methCall(datNonVoid(free_2_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_16)}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_0_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(LIT_15),
+        datNonVoid(
+          methCall(datNonVoid(free_1_name), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+/* @expect */
+static FUN_IMPL_DECL(9) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "name"
+  zvalue arg_0_name =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  // "result"
+  zvalue arg_1_result =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { rest.elems[0] }});
+
+  // "func"
+  zvalue arg_2_func =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { rest.elems[1] }});
+
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "If" */ zvalue free_1_If = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  methCall(
+    methCall(datNonVoid(free_1_If), SYM(fetch), (zarray) {0, NULL}),
+    LIT_9,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(makeClosure_4(arg_2_func)),
+      datNonVoid(
+        makeClosure_7(
+          free_0__Format,
+          free_2_die,
+          arg_0_name,
+          free_3_note,
+          arg_1_result)),
+      datNonVoid(makeClosure_8(free_2_die, arg_0_name, free_3_note))}});
+
+  return NULL;
+}
+
+static FUN_IMPL_DECL(10) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "got"
+  zvalue arg_0_got =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  /* "name" */ zvalue free_2_name = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  methCall(
+    methCall(datNonVoid(free_3_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(LIT_18),
+      datNonVoid(
+        methCall(
+          methCall(
+            methCall(
+              datNonVoid(free_0__Format),
+              SYM(fetch),
+              (zarray) {0,
+              NULL}),
+            LIT_2,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_3)}}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(
+              methCall(datNonVoid(arg_0_got), SYM(fetch), (zarray) {0, NULL}))}}))}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_1_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(LIT_15),
+        datNonVoid(
+          methCall(datNonVoid(free_2_name), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+/* @expectVoid */
+static FUN_IMPL_DECL(11) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "name"
+  zvalue arg_0_name =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  // "func"
+  zvalue arg_1_func =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { rest.elems[0] }});
+
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "If" */ zvalue free_1_If = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  methCall(
+    methCall(datNonVoid(free_1_If), SYM(fetch), (zarray) {0, NULL}),
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(makeClosure_4(arg_1_func)),
+      datNonVoid(
+        makeClosure_10(free_0__Format, free_2_die, arg_0_name, free_3_note))}});
+
+  return NULL;
+}
+
+static FUN_IMPL_DECL(12) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "n" */ zvalue free_0_n = state[0];
+  return
+    methCall(
+      LIT_0,
+      LIT_1,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_n), SYM(fetch), (zarray) {0, NULL})),
+        datNonVoid(LIT_20)}});
+
+}
+
+static FUN_IMPL_DECL(13) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(LIT_21)}})));
+
+}
+
+/* @countDown */
+static FUN_IMPL_DECL(14) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "countDown" */ zvalue free_0_countDown = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 4>"
+  zvalue local_3__closure_4_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 5>"
+  zvalue local_4__closure_5_ =
+    cm_newBox(Result, datNonVoid(makeClosure_13(yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_3__closure_4_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_5_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_countDown), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {1,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(
+              methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+              LIT_22,
+              (zarray) {1,
+              (zvalue[]) {
+                datNonVoid(LIT_6)}}))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(15) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(LIT_24)}})));
+
+}
+
+/* @isEven */
+static FUN_IMPL_DECL(16) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "isOdd" */ zvalue free_0_isOdd = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 6>"
+  zvalue local_3__closure_6_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 7>"
+  zvalue local_4__closure_7_ =
+    cm_newBox(Result, datNonVoid(makeClosure_15(yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_3__closure_6_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_7_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_isOdd), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {1,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(
+              methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+              LIT_22,
+              (zarray) {1,
+              (zvalue[]) {
+                datNonVoid(LIT_6)}}))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(17) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(LIT_26)}})));
+
+}
+
+/* @isOdd */
+static FUN_IMPL_DECL(18) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "isEven" */ zvalue free_0_isEven = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 8>"
+  zvalue local_3__closure_8_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 9>"
+  zvalue local_4__closure_9_ =
+    cm_newBox(Result, datNonVoid(makeClosure_17(yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_3__closure_8_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_9_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_isEven), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {1,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(
+              methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+              LIT_22,
+              (zarray) {1,
+              (zvalue[]) {
+                datNonVoid(LIT_6)}}))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(19) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "die" */ zvalue free_0_die = state[0];
+  /* "exit" */ zvalue free_1_exit = state[1];
+  methCall(
+    methCall(datNonVoid(free_1_exit), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_28)}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_0_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(LIT_29)}});
+
+}
+
+/* @descend */
+static FUN_IMPL_DECL(20) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  // "exit"
+  zvalue arg_1_exit =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { rest.elems[0] }});
+
+  /* "descend" */ zvalue free_0_descend = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  // @"<closure 10>"
+  zvalue local_4__closure_10_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 11>"
+  zvalue local_5__closure_11_ =
+    cm_newBox(Result, datNonVoid(makeClosure_19(free_1_die, arg_1_exit)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_10_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_5__closure_11_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  return
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_descend), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {2,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(
+              methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+              LIT_22,
+              (zarray) {1,
+              (zvalue[]) {
+                datNonVoid(LIT_6)}})),
+          datNonVoid(
+            methCall(datNonVoid(arg_1_exit), SYM(fetch), (zarray) {0, NULL}))}}));
+
+}
+
+static FUN_IMPL_DECL(21) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "value"
+  zvalue arg_0_value =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(
+              methCall(
+                datNonVoid(arg_0_value),
+                SYM(fetch),
+                (zarray) {0,
+                NULL}))}})));
+
+}
+
+/* @descendFrom */
+static FUN_IMPL_DECL(22) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "descend" */ zvalue free_0_descend = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_descend), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {2,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL})),
+          datNonVoid(makeClosure_21(yield_return))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(23) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "die" */ zvalue free_0_die = state[0];
+  /* "return" */ zvalue free_1_return = state[1];
+  mustNotYield(
+    methCall(
+      methCall(datNonVoid(free_1_return), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(LIT_32)}}));
+
+  return
+    methCall(
+      methCall(datNonVoid(free_0_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(LIT_29)}});
+
+}
+
+/* @countDownWithExit */
+static FUN_IMPL_DECL(24) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "countDownWithExit" */ zvalue free_0_countDownWithExit = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 12>"
+  zvalue local_4__closure_12_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 13>"
+  zvalue local_5__closure_13_ =
+    cm_newBox(Result, datNonVoid(makeClosure_23(free_1_die, yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_12_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_5__closure_13_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(
+          datNonVoid(free_0_countDownWithExit),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}),
+        LIT_4,
+        (zarray) {1,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(
+              methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+              LIT_22,
+              (zarray) {1,
+              (zvalue[]) {
+                datNonVoid(LIT_6)}}))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(25) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {0,
+          NULL})));
+
+}
+
+/* @maybeVoid */
+static FUN_IMPL_DECL(26) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "maybeVoid" */ zvalue free_0_maybeVoid = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 14>"
+  zvalue local_3__closure_14_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 15>"
+  zvalue local_4__closure_15_ =
+    cm_newBox(Result, datNonVoid(makeClosure_25(yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_3__closure_14_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_15_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    methCall(
+      methCall(datNonVoid(free_0_maybeVoid), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(
+            methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+            LIT_22,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_6)}}))}});
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(27) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "return" */ zvalue free_0_return = state[0];
+  return
+    datNonVoid(
+      mustNotYield(
+        methCall(
+          methCall(datNonVoid(free_0_return), SYM(fetch), (zarray) {0, NULL}),
+          LIT_4,
+          (zarray) {1,
+          (zvalue[]) {
+            datNonVoid(LIT_20)}})));
+
+}
+
+/* @maybeValue */
+static FUN_IMPL_DECL(28) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "maybeValue" */ zvalue free_0_maybeValue = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  // @"<closure 16>"
+  zvalue local_3__closure_16_ =
+    cm_newBox(Result, datNonVoid(makeClosure_12(arg_0_n)));
+
+  // @"<closure 17>"
+  zvalue local_4__closure_17_ =
+    cm_newBox(Result, datNonVoid(makeClosure_27(yield_return)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_3__closure_16_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_4__closure_17_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  zvalue result =
+    methCall(
+      methCall(datNonVoid(free_0_maybeValue), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(
+            methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}),
+            LIT_22,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_6)}}))}});
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+/* @maybeVoidThenValue */
+static FUN_IMPL_DECL(29) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  // "n"
+  zvalue arg_0_n =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { first }});
+
+  /* "maybeVoid" */ zvalue free_0_maybeVoid = state[0];
+  return
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_0_maybeVoid), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {1,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(datNonVoid(arg_0_n), SYM(fetch), (zarray) {0, NULL}))}}));
+
+}
+
+/* @stash */
+static FUN_IMPL_DECL(30) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  /* "stashed" */ zvalue free_0_stashed = state[0];
+  // "<@return>"
+  zvalue yield_return =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  cm_store(free_0_stashed, datNonVoid(makeClosure_21(yield_return)));
+  zvalue result = datNonVoid(LIT_38);
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(31) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "countDown" */ zvalue free_1_countDown = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_countDown), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(32) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "isEven" */ zvalue free_1_isEven = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_isEven), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(
+            methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}),
+            LIT_39,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_6)}}))}});
+
+}
+
+static FUN_IMPL_DECL(33) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "isOdd" */ zvalue free_1_isOdd = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_isOdd), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(
+            methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}),
+            LIT_39,
+            (zarray) {1,
+            (zvalue[]) {
+              datNonVoid(LIT_6)}}))}});
+
+}
+
+static FUN_IMPL_DECL(34) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "descend" */ zvalue free_1_descend = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  // "<@out>"
+  zvalue yield_out =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  methCall(
+    methCall(datNonVoid(free_1_descend), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL})),
+      datNonVoid(
+        methCall(datNonVoid(yield_out), SYM(fetch), (zarray) {0, NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_2_die), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_40)}});
+
+  jumpRetire(&jumpTarget);
+  return NULL;
+}
+
+static FUN_IMPL_DECL(35) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "descend" */ zvalue free_1_descend = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  return
+    methCall(
+      makeClosure_34(free_0_DEPTH, free_1_descend, free_2_die),
+      LIT_4,
+      (zarray) {0,
+      NULL});
+
+}
+
+static FUN_IMPL_DECL(36) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  JumpTarget jumpTarget;
+  jumpArm(&jumpTarget);
+  zvalue jump = makeJump(&jumpTarget, true);
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "descend" */ zvalue free_1_descend = state[1];
+  // "<@out>"
+  zvalue yield_out =
+    methCall(CLS_Result, SYM(new), (zarray) {1, (zvalue[]) { jump }});
+
+  zvalue result =
+    datNonVoid(
+      methCall(
+        methCall(datNonVoid(free_1_descend), SYM(fetch), (zarray) {0, NULL}),
+        LIT_4,
+        (zarray) {2,
+        (zvalue[]) {
+          datNonVoid(
+            methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL})),
+          datNonVoid(
+            methCall(datNonVoid(yield_out), SYM(fetch), (zarray) {0, NULL}))}}));
+
+  jumpRetire(&jumpTarget);
+  return result;
+}
+
+static FUN_IMPL_DECL(37) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "descend" */ zvalue free_1_descend = state[1];
+  return
+    methCall(
+      makeClosure_36(free_0_DEPTH, free_1_descend),
+      LIT_4,
+      (zarray) {0,
+      NULL});
+
+}
+
+static FUN_IMPL_DECL(38) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "descendFrom" */ zvalue free_1_descendFrom = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_descendFrom), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(39) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "countDownWithExit" */ zvalue free_1_countDownWithExit = state[1];
+  return
+    methCall(
+      methCall(
+        datNonVoid(free_1_countDownWithExit),
+        SYM(fetch),
+        (zarray) {0,
+        NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(40) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "maybeVoid" */ zvalue free_1_maybeVoid = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_maybeVoid), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(41) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "maybeValue" */ zvalue free_1_maybeValue = state[1];
+  return
+    methCall(
+      methCall(datNonVoid(free_1_maybeValue), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+}
+
+static FUN_IMPL_DECL(42) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "stash" */ zvalue free_0_stash = state[0];
+  return
+    methCall(
+      methCall(datNonVoid(free_0_stash), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {0,
+      NULL});
+
+}
+
+static FUN_IMPL_DECL(43) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "die" */ zvalue free_0_die = state[0];
+  /* "expect" */ zvalue free_1_expect = state[1];
+  /* "note" */ zvalue free_2_note = state[2];
+  /* "stash" */ zvalue free_3_stash = state[3];
+  /* "stashed" */ zvalue free_4_stashed = state[4];
+  methCall(
+    methCall(datNonVoid(free_2_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_41)}});
+
+  methCall(
+    methCall(datNonVoid(free_1_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_42),
+      datNonVoid(LIT_38),
+      datNonVoid(makeClosure_42(free_3_stash))}});
+
+  methCall(
+    methCall(datNonVoid(free_4_stashed), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_43)}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_0_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(LIT_44)}});
+
+}
+
+static FUN_IMPL_DECL(44) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "args" */ zvalue free_0_args = state[0];
+  return
+    methCall(
+      LIT_0,
+      LIT_1,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_args), SYM(fetch), (zarray) {0, NULL})),
+        datNonVoid(LIT_58)}});
+
+}
+
+static FUN_IMPL_DECL(45) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "args" */ zvalue free_0_args = state[0];
+  return
+    methCall(
+      LIT_0,
+      LIT_1,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(
+          methCall(datNonVoid(free_0_args), SYM(fetch), (zarray) {0, NULL})),
+        datNonVoid(LIT_59)}});
+
+}
+
+static FUN_IMPL_DECL(46) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* Unnamed formal 0 */;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "die" */ zvalue free_1_die = state[1];
+  /* "maybeVoidThenValue" */ zvalue free_2_maybeVoidThenValue = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  methCall(
+    methCall(datNonVoid(free_3_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_60)}});
+
+  methCall(
+    methCall(
+      datNonVoid(free_2_maybeVoidThenValue),
+      SYM(fetch),
+      (zarray) {0,
+      NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(datNonVoid(free_0_DEPTH), SYM(fetch), (zarray) {0, NULL}))}});
+
+  return
+    methCall(
+      methCall(datNonVoid(free_1_die), SYM(fetch), (zarray) {0, NULL}),
+      LIT_4,
+      (zarray) {1,
+      (zvalue[]) {
+        datNonVoid(LIT_61)}});
+
+}
+
+static FUN_IMPL_DECL(47) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "DEPTH" */ zvalue free_0_DEPTH = state[0];
+  /* "args" */ zvalue free_1_args = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  /* "maybeVoidThenValue" */ zvalue free_3_maybeVoidThenValue = state[3];
+  /* "note" */ zvalue free_4_note = state[4];
+  return
+    methCall(
+      LIT_8,
+      LIT_9,
+      (zarray) {2,
+      (zvalue[]) {
+        datNonVoid(makeClosure_45(free_1_args)),
+        datNonVoid(
+          makeClosure_46(
+            free_0_DEPTH,
+            free_2_die,
+            free_3_maybeVoidThenValue,
+            free_4_note))}});
+
+}
+
+/* @main */
+static FUN_IMPL_DECL(48) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  zvalue argsElems[rest.size + 1];
+  zarray args = zarrayFromArgs(first, rest, argsElems);
+  zint argAt = 0;
+  zvalue raw_arg_0_selfPath =
+    (argAt >= args.size) ? EMPTY_LIST : args.elems[argAt];
+
+  if (argAt < args.size) { argAt++; };
+  zvalue raw_arg_1_args =
+    listFromZarray((zarray) {args.size - argAt, &args.elems[argAt]});
+
+  argAt = args.size;
+  // "selfPath"
+  zvalue arg_0_selfPath =
+    methCall(
+      CLS_Result,
+      SYM(new),
+      (zarray) {1,
+      (zvalue[]) {
+        raw_arg_0_selfPath}});
+
+  // "args"
+  zvalue arg_1_args =
+    methCall(
+      CLS_Result,
+      SYM(new),
+      (zarray) {1,
+      (zvalue[]) {
+        raw_arg_1_args}});
+
+  /* "<closure 18>" */ zvalue free_0__closure_18_ = state[0];
+  /* "<closure 19>" */ zvalue free_1__closure_19_ = state[1];
+  /* "<closure 20>" */ zvalue free_2__closure_20_ = state[2];
+  /* "<closure 21>" */ zvalue free_3__closure_21_ = state[3];
+  /* "<closure 22>" */ zvalue free_4__closure_22_ = state[4];
+  /* "<closure 23>" */ zvalue free_5__closure_23_ = state[5];
+  /* "<closure 24>" */ zvalue free_6__closure_24_ = state[6];
+  /* "<closure 25>" */ zvalue free_7__closure_25_ = state[7];
+  /* "<closure 26>" */ zvalue free_8__closure_26_ = state[8];
+  /* "<closure 28>" */ zvalue free_9__closure_28_ = state[9];
+  /* "DEPTH" */ zvalue free_10_DEPTH = state[10];
+  /* "die" */ zvalue free_11_die = state[11];
+  /* "expect" */ zvalue free_12_expect = state[12];
+  /* "expectVoid" */ zvalue free_13_expectVoid = state[13];
+  /* "maybeVoidThenValue" */ zvalue free_14_maybeVoidThenValue = state[14];
+  /* "note" */ zvalue free_15_note = state[15];
+  methCall(
+    methCall(datNonVoid(free_15_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_46)}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_47),
+      datNonVoid(LIT_21),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_0__closure_18_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_48),
+      datNonVoid(LIT_26),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_1__closure_19_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_49),
+      datNonVoid(LIT_24),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_2__closure_20_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_15_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_50)}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_51),
+      datNonVoid(LIT_28),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_3__closure_21_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_52),
+      datNonVoid(LIT_28),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_4__closure_22_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_53),
+      datNonVoid(LIT_28),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_5__closure_23_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_54),
+      datNonVoid(LIT_32),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_6__closure_24_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_15_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_55)}});
+
+  methCall(
+    methCall(datNonVoid(free_13_expectVoid), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {2,
+    (zvalue[]) {
+      datNonVoid(LIT_56),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_7__closure_25_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_12_expect), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(LIT_57),
+      datNonVoid(LIT_20),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_8__closure_26_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  // @"<closure 27>"
+  zvalue local_18__closure_27_ =
+    cm_newBox(Result, datNonVoid(makeClosure_44(arg_1_args)));
+
+  // @"<closure 29>"
+  zvalue local_19__closure_29_ =
+    cm_newBox(
+      Result,
+      datNonVoid(
+        makeClosure_47(
+          free_10_DEPTH,
+          arg_1_args,
+          free_11_die,
+          free_14_maybeVoidThenValue,
+          free_15_note)));
+
+  methCall(
+    LIT_8,
+    LIT_9,
+    (zarray) {3,
+    (zvalue[]) {
+      datNonVoid(
+        methCall(
+          datNonVoid(local_18__closure_27_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(free_9__closure_28_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL})),
+      datNonVoid(
+        methCall(
+          datNonVoid(local_19__closure_29_),
+          SYM(fetch),
+          (zarray) {0,
+          NULL}))}});
+
+  methCall(
+    methCall(datNonVoid(free_15_note), SYM(fetch), (zarray) {0, NULL}),
+    LIT_4,
+    (zarray) {1,
+    (zvalue[]) {
+      datNonVoid(LIT_62)}});
+
+  return NULL;
+}
+
+static FUN_IMPL_DECL(49) {
+  zvalue *state = builtinGetState(thisFunction).arr;
+  /* "$Format" */ zvalue free_0__Format = state[0];
+  /* "If" */ zvalue free_1_If = state[1];
+  /* "die" */ zvalue free_2_die = state[2];
+  /* "note" */ zvalue free_3_note = state[3];
+  /* @expect */ zvalue local_4_expect = cm_newBox(Promise, NULL);
+  /* @expectVoid */ zvalue local_5_expectVoid = cm_newBox(Promise, NULL);
+  /* @countDown */ zvalue local_6_countDown = cm_newBox(Promise, NULL);
+  /* @isEven */ zvalue local_7_isEven = cm_newBox(Promise, NULL);
+  /* @isOdd */ zvalue local_8_isOdd = cm_newBox(Promise, NULL);
+  /* @descend */ zvalue local_9_descend = cm_newBox(Promise, NULL);
+  /* @descendFrom */ zvalue local_10_descendFrom = cm_newBox(Promise, NULL);
+  // @countDownWithExit
+  zvalue local_11_countDownWithExit = cm_newBox(Promise, NULL);
+
+  /* @maybeVoid */ zvalue local_12_maybeVoid = cm_newBox(Promise, NULL);
+  /* @maybeValue */ zvalue local_13_maybeValue = cm_newBox(Promise, NULL);
+  // @maybeVoidThenValue
+  zvalue local_14_maybeVoidThenValue = cm_newBox(Promise, NULL);
+
+  /* @stash */ zvalue local_15_stash = cm_newBox(Promise, NULL);
+  /* @main */ zvalue local_16_main = cm_newBox(Promise, NULL);
+  // @INTERPRETED
+  zvalue local_17_INTERPRETED =
+    cm_newBox(
+      Result,
+      datNonVoid(
+        methCall(
+          LIT_0,
+          LIT_1,
+          (zarray) {2,
+          (zvalue[]) {
+            datNonVoid(
+              methCall(
+                methCall(
+                  methCall(
+                    datNonVoid(free_0__Format),
+                    SYM(fetch),
+                    (zarray) {0,
+                    NULL}),
+                  LIT_2,
+                  (zarray) {1,
+                  (zvalue[]) {
+                    datNonVoid(LIT_3)}}),
+                LIT_4,
+                (zarray) {1,
+                (zvalue[]) {
+                  datNonVoid(makeClosure_0())}})),
+            datNonVoid(LIT_7)}})));
+
+  // @"<closure 1>"
+  zvalue local_18__closure_1_ =
+    cm_newBox(Result, datNonVoid(makeClosure_1(local_17_INTERPRETED)));
+
+  // @DEPTH
+  zvalue local_19_DEPTH =
+    cm_newBox(
+      Result,
+      datNonVoid(
+        methCall(
+          LIT_8,
+          LIT_9,
+          (zarray) {3,
+          (zvalue[]) {
+            datNonVoid(
+              methCall(
+                datNonVoid(local_18__closure_1_),
+                SYM(fetch),
+                (zarray) {0,
+                NULL})),
+            datNonVoid(makeClosure_2()),
+            datNonVoid(makeClosure_3())}})));
+
+  cm_store(
+    local_4_expect,
+    datNonVoid(
+      makeClosure_9(free_0__Format, free_1_If, free_2_die, free_3_note)));
+
+  cm_store(
+    local_5_expectVoid,
+    datNonVoid(
+      makeClosure_11(free_0__Format, free_1_If, free_2_die, free_3_note)));
+
+  cm_store(local_6_countDown, datNonVoid(makeClosure_14(local_6_countDown)));
+  cm_store(local_7_isEven, datNonVoid(makeClosure_16(local_8_isOdd)));
+  cm_store(local_8_isOdd, datNonVoid(makeClosure_18(local_7_isEven)));
+  cm_store(
+    local_9_descend,
+    datNonVoid(makeClosure_20(local_9_descend, free_2_die)));
+
+  cm_store(local_10_descendFrom, datNonVoid(makeClosure_22(local_9_descend)));
+  cm_store(
+    local_11_countDownWithExit,
+    datNonVoid(makeClosure_24(local_11_countDownWithExit, free_2_die)));
+
+  cm_store(local_12_maybeVoid, datNonVoid(makeClosure_26(local_12_maybeVoid)));
+
+  cm_store(
+    local_13_maybeValue,
+    datNonVoid(makeClosure_28(local_13_maybeValue)));
+
+  cm_store(
+    local_14_maybeVoidThenValue,
+    datNonVoid(makeClosure_29(local_12_maybeVoid)));
+
+  /* @stashed */ zvalue local_20_stashed = cm_newBox(Cell, datNonVoid(LIT_36));
+
+  cm_store(local_15_stash, datNonVoid(makeClosure_30(local_20_stashed)));
+  // @"<closure 18>"
+  zvalue local_21__closure_18_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_31(local_19_DEPTH, local_6_countDown)));
+
+  // @"<closure 19>"
+  zvalue local_22__closure_19_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_32(local_19_DEPTH, local_7_isEven)));
+
+  // @"<closure 20>"
+  zvalue local_23__closure_20_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_33(local_19_DEPTH, local_8_isOdd)));
+
+  // @"<closure 21>"
+  zvalue local_24__closure_21_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_35(local_19_DEPTH, local_9_descend, free_2_die)));
+
+  // @"<closure 22>"
+  zvalue local_25__closure_22_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_37(local_19_DEPTH, local_9_descend)));
+
+  // @"<closure 23>"
+  zvalue local_26__closure_23_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_38(local_19_DEPTH, local_10_descendFrom)));
+
+  // @"<closure 24>"
+  zvalue local_27__closure_24_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_39(local_19_DEPTH, local_11_countDownWithExit)));
+
+  // @"<closure 25>"
+  zvalue local_28__closure_25_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_40(local_19_DEPTH, local_12_maybeVoid)));
+
+  // @"<closure 26>"
+  zvalue local_29__closure_26_ =
+    cm_newBox(
+      Result,
+      datNonVoid(makeClosure_41(local_19_DEPTH, local_13_maybeValue)));
+
+  // @"<closure 28>"
+  zvalue local_30__closure_28_ =
+    cm_newBox(
+      Result,
+      datNonVoid(
+        makeClosure_43(
+          free_2_die,
+          local_4_expect,
+          free_3_note,
+          local_15_stash,
+          local_20_stashed)));
+
+  cm_store(
+    local_16_main,
+    datNonVoid(
+      makeClosure_48(
+        local_21__closure_18_,
+        local_22__closure_19_,
+        local_23__closure_20_,
+        local_24__closure_21_,
+        local_25__closure_22_,
+        local_26__closure_23_,
+        local_27__closure_24_,
+        local_28__closure_25_,
+        local_29__closure_26_,
+        local_30__closure_28_,
+        local_19_DEPTH,
+        free_2_die,
+        local_4_expect,
+        local_5_expectVoid,
+        local_14_maybeVoidThenValue,
+        free_3_note)));
+
+  return
+    datNonVoid(
+      methCall(
+        LIT_63,
+        LIT_64,
+        (zarray) {2,
+        (zvalue[]) {
+          datNonVoid(LIT_65),
+          datNonVoid(
+            methCall(
+              LIT_66,
+              LIT_64,
+              (zarray) {4,
+              (zvalue[]) {
+                datNonVoid(LIT_67),
+                datNonVoid(
+                  methCall(
+                    LIT_66,
+                    LIT_64,
+                    (zarray) {2,
+                    (zvalue[]) {
+                      datNonVoid(LIT_45),
+                      datNonVoid(
+                        methCall(
+                          datNonVoid(local_16_main),
+                          SYM(fetch),
+                          (zarray) {0,
+                          NULL}))}})),
+                datNonVoid(LIT_68),
+                datNonVoid(LIT_69)}}))}}));
+
+}
+
+
+/* @probe */ static zvalue makeClosure_0() {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(0),
+      0,
+      LIT_5);
+  zvalue *state = builtinGetState(result).arr;
+
+  return result;
+}
+
+static zvalue makeClosure_1(/* @INTERPRETED */ zvalue free_0_INTERPRETED) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(1),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_INTERPRETED;
+  return result;
+}
+
+static zvalue makeClosure_2() {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(2),
+      0,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+
+  return result;
+}
+
+static zvalue makeClosure_3() {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(3),
+      0,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+
+  return result;
+}
+
+static zvalue makeClosure_4(/* @func */ zvalue free_0_func) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(4),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_func;
+  return result;
+}
+
+static zvalue makeClosure_5(
+  /* @got */ zvalue free_0_got,
+  /* @result */ zvalue free_1_result) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(5),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_got;  state[1] = free_1_result;
+  return result;
+}
+
+static zvalue makeClosure_6(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @got */ zvalue free_2_got,
+  /* @name */ zvalue free_3_name,
+  /* @note */ zvalue free_4_note) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(6),
+      5,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_die;  state[2] = free_2_got;  state[3] = free_3_name;  state[4] = free_4_note;
+  return result;
+}
+
+static zvalue makeClosure_7(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @name */ zvalue free_2_name,
+  /* @note */ zvalue free_3_note,
+  /* @result */ zvalue free_4_result) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(7),
+      5,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_die;  state[2] = free_2_name;  state[3] = free_3_note;  state[4] = free_4_result;
+  return result;
+}
+
+static zvalue makeClosure_8(
+  /* @die */ zvalue free_0_die,
+  /* @name */ zvalue free_1_name,
+  /* @note */ zvalue free_2_note) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(8),
+      3,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_die;  state[1] = free_1_name;  state[2] = free_2_note;
+  return result;
+}
+
+// @expect
+static zvalue makeClosure_9(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note) {
+  zvalue result =
+    makeBuiltin(
+      3,
+      3,
+      FUN_IMPL_NAME(9),
+      4,
+      LIT_12);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_If;  state[2] = free_2_die;  state[3] = free_3_note;
+  return result;
+}
+
+static zvalue makeClosure_10(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @die */ zvalue free_1_die,
+  /* @name */ zvalue free_2_name,
+  /* @note */ zvalue free_3_note) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(10),
+      4,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_die;  state[2] = free_2_name;  state[3] = free_3_note;
+  return result;
+}
+
+// @expectVoid
+static zvalue makeClosure_11(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note) {
+  zvalue result =
+    makeBuiltin(
+      2,
+      2,
+      FUN_IMPL_NAME(11),
+      4,
+      LIT_17);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_If;  state[2] = free_2_die;  state[3] = free_3_note;
+  return result;
+}
+
+static zvalue makeClosure_12(/* @n */ zvalue free_0_n) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(12),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_n;
+  return result;
+}
+
+static zvalue makeClosure_13(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(13),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+// @countDown
+static zvalue makeClosure_14(/* @countDown */ zvalue free_0_countDown) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(14),
+      1,
+      LIT_19);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_countDown;
+  return result;
+}
+
+static zvalue makeClosure_15(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(15),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+/* @isEven */ static zvalue makeClosure_16(/* @isOdd */ zvalue free_0_isOdd) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(16),
+      1,
+      LIT_23);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_isOdd;
+  return result;
+}
+
+static zvalue makeClosure_17(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(17),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+/* @isOdd */ static zvalue makeClosure_18(/* @isEven */ zvalue free_0_isEven) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(18),
+      1,
+      LIT_25);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_isEven;
+  return result;
+}
+
+static zvalue makeClosure_19(
+  /* @die */ zvalue free_0_die,
+  /* @exit */ zvalue free_1_exit) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(19),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_die;  state[1] = free_1_exit;
+  return result;
+}
+
+// @descend
+static zvalue makeClosure_20(
+  /* @descend */ zvalue free_0_descend,
+  /* @die */ zvalue free_1_die) {
+  zvalue result =
+    makeBuiltin(
+      2,
+      2,
+      FUN_IMPL_NAME(20),
+      2,
+      LIT_27);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_descend;  state[1] = free_1_die;
+  return result;
+}
+
+static zvalue makeClosure_21(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(21),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+// @descendFrom
+static zvalue makeClosure_22(/* @descend */ zvalue free_0_descend) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(22),
+      1,
+      LIT_30);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_descend;
+  return result;
+}
+
+static zvalue makeClosure_23(
+  /* @die */ zvalue free_0_die,
+  /* @return */ zvalue free_1_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(23),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_die;  state[1] = free_1_return;
+  return result;
+}
+
+// @countDownWithExit
+static zvalue makeClosure_24(
+  /* @countDownWithExit */ zvalue free_0_countDownWithExit,
+  /* @die */ zvalue free_1_die) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(24),
+      2,
+      LIT_31);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_countDownWithExit;  state[1] = free_1_die;
+  return result;
+}
+
+static zvalue makeClosure_25(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(25),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+// @maybeVoid
+static zvalue makeClosure_26(/* @maybeVoid */ zvalue free_0_maybeVoid) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(26),
+      1,
+      LIT_33);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_maybeVoid;
+  return result;
+}
+
+static zvalue makeClosure_27(/* @return */ zvalue free_0_return) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(27),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_return;
+  return result;
+}
+
+// @maybeValue
+static zvalue makeClosure_28(/* @maybeValue */ zvalue free_0_maybeValue) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(28),
+      1,
+      LIT_34);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_maybeValue;
+  return result;
+}
+
+// @maybeVoidThenValue
+static zvalue makeClosure_29(/* @maybeVoid */ zvalue free_0_maybeVoid) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(29),
+      1,
+      LIT_35);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_maybeVoid;
+  return result;
+}
+
+// @stash
+static zvalue makeClosure_30(/* @stashed */ zvalue free_0_stashed) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(30),
+      1,
+      LIT_37);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_stashed;
+  return result;
+}
+
+static zvalue makeClosure_31(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @countDown */ zvalue free_1_countDown) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(31),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_countDown;
+  return result;
+}
+
+static zvalue makeClosure_32(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @isEven */ zvalue free_1_isEven) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(32),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_isEven;
+  return result;
+}
+
+static zvalue makeClosure_33(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @isOdd */ zvalue free_1_isOdd) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(33),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_isOdd;
+  return result;
+}
+
+static zvalue makeClosure_34(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend,
+  /* @die */ zvalue free_2_die) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(34),
+      3,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_descend;  state[2] = free_2_die;
+  return result;
+}
+
+static zvalue makeClosure_35(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend,
+  /* @die */ zvalue free_2_die) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(35),
+      3,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_descend;  state[2] = free_2_die;
+  return result;
+}
+
+static zvalue makeClosure_36(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(36),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_descend;
+  return result;
+}
+
+static zvalue makeClosure_37(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descend */ zvalue free_1_descend) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(37),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_descend;
+  return result;
+}
+
+static zvalue makeClosure_38(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @descendFrom */ zvalue free_1_descendFrom) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(38),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_descendFrom;
+  return result;
+}
+
+static zvalue makeClosure_39(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @countDownWithExit */ zvalue free_1_countDownWithExit) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(39),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_countDownWithExit;
+  return result;
+}
+
+static zvalue makeClosure_40(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @maybeVoid */ zvalue free_1_maybeVoid) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(40),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_maybeVoid;
+  return result;
+}
+
+static zvalue makeClosure_41(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @maybeValue */ zvalue free_1_maybeValue) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(41),
+      2,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_maybeValue;
+  return result;
+}
+
+static zvalue makeClosure_42(/* @stash */ zvalue free_0_stash) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(42),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_stash;
+  return result;
+}
+
+static zvalue makeClosure_43(
+  /* @die */ zvalue free_0_die,
+  /* @expect */ zvalue free_1_expect,
+  /* @note */ zvalue free_2_note,
+  /* @stash */ zvalue free_3_stash,
+  /* @stashed */ zvalue free_4_stashed) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(43),
+      5,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_die;  state[1] = free_1_expect;  state[2] = free_2_note;  state[3] = free_3_stash;  state[4] = free_4_stashed;
+  return result;
+}
+
+static zvalue makeClosure_44(/* @args */ zvalue free_0_args) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(44),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_args;
+  return result;
+}
+
+static zvalue makeClosure_45(/* @args */ zvalue free_0_args) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(45),
+      1,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_args;
+  return result;
+}
+
+static zvalue makeClosure_46(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @die */ zvalue free_1_die,
+  /* @maybeVoidThenValue */ zvalue free_2_maybeVoidThenValue,
+  /* @note */ zvalue free_3_note) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      1,
+      FUN_IMPL_NAME(46),
+      4,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_die;  state[2] = free_2_maybeVoidThenValue;  state[3] = free_3_note;
+  return result;
+}
+
+static zvalue makeClosure_47(
+  /* @DEPTH */ zvalue free_0_DEPTH,
+  /* @args */ zvalue free_1_args,
+  /* @die */ zvalue free_2_die,
+  /* @maybeVoidThenValue */ zvalue free_3_maybeVoidThenValue,
+  /* @note */ zvalue free_4_note) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(47),
+      5,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0_DEPTH;  state[1] = free_1_args;  state[2] = free_2_die;  state[3] = free_3_maybeVoidThenValue;  state[4] = free_4_note;
+  return result;
+}
+
+// @main
+static zvalue makeClosure_48(
+  /* @"<closure 18>" */ zvalue free_0__closure_18_,
+  /* @"<closure 19>" */ zvalue free_1__closure_19_,
+  /* @"<closure 20>" */ zvalue free_2__closure_20_,
+  /* @"<closure 21>" */ zvalue free_3__closure_21_,
+  /* @"<closure 22>" */ zvalue free_4__closure_22_,
+  /* @"<closure 23>" */ zvalue free_5__closure_23_,
+  /* @"<closure 24>" */ zvalue free_6__closure_24_,
+  /* @"<closure 25>" */ zvalue free_7__closure_25_,
+  /* @"<closure 26>" */ zvalue free_8__closure_26_,
+  /* @"<closure 28>" */ zvalue free_9__closure_28_,
+  /* @DEPTH */ zvalue free_10_DEPTH,
+  /* @die */ zvalue free_11_die,
+  /* @expect */ zvalue free_12_expect,
+  /* @expectVoid */ zvalue free_13_expectVoid,
+  /* @maybeVoidThenValue */ zvalue free_14_maybeVoidThenValue,
+  /* @note */ zvalue free_15_note) {
+  zvalue result =
+    makeBuiltin(
+      1,
+      -1,
+      FUN_IMPL_NAME(48),
+      16,
+      LIT_45);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__closure_18_;  state[1] = free_1__closure_19_;  state[2] = free_2__closure_20_;  state[3] = free_3__closure_21_;  state[4] = free_4__closure_22_;  state[5] = free_5__closure_23_;  state[6] = free_6__closure_24_;  state[7] = free_7__closure_25_;  state[8] = free_8__closure_26_;  state[9] = free_9__closure_28_;  state[10] = free_10_DEPTH;  state[11] = free_11_die;  state[12] = free_12_expect;  state[13] = free_13_expectVoid;  state[14] = free_14_maybeVoidThenValue;  state[15] = free_15_note;
+  return result;
+}
+
+static zvalue makeClosure_49(
+  /* @"$Format" */ zvalue free_0__Format,
+  /* @If */ zvalue free_1_If,
+  /* @die */ zvalue free_2_die,
+  /* @note */ zvalue free_3_note) {
+  zvalue result =
+    makeBuiltin(
+      0,
+      0,
+      FUN_IMPL_NAME(49),
+      4,
+      NULL);
+  zvalue *state = builtinGetState(result).arr;
+  state[0] = free_0__Format;  state[1] = free_1_If;  state[2] = free_2_die;  state[3] = free_3_note;
+  return result;
+}
+
+
+static zvalue mainClosure(void) {
+  return
+    makeClosure_49(
+      // @"$Format"
+      methCall(
+        CLS_Result,
+        SYM(new),
+        (zarray) {1,
+        (zvalue[]) {
+          cm_get(GLOBALS, LIT_70)}}),
+      // @If
+      methCall(
+        CLS_Result,
+        SYM(new),
+        (zarray) {1,
+        (zvalue[]) {
+          cm_get(GLOBALS, LIT_71)}}),
+      // @die
+      methCall(
+        CLS_Result,
+        SYM(new),
+        (zarray) {1,
+        (zvalue[]) {
+          cm_get(GLOBALS, LIT_72)}}),
+      // @note
+      methCall(
+        CLS_Result,
+        SYM(new),
+        (zarray) {1,
+        (zvalue[]) {
+          cm_get(GLOBALS, LIT_73)}}));
+}
+
+
+//
+// Main entry point
+//
+
+/** Top-level evaluation result. */
+static zvalue NODE_RESULT = NULL;
+
+zvalue eval(zvalue env) {
+  if (GLOBALS == NULL) {
+    GLOBALS = env;
+    initLiterals(env);
+  } else if (!cmpEq(GLOBALS, env)) {
+    die("Cannot re-eval with different global environment.");
+  }
+
+  if (NODE_RESULT == NULL) {
+    NODE_RESULT = mainClosure();
+    datImmortalize(NODE_RESULT);
+  }
+
+  return NODE_RESULT;
+}
@@ -0,0 +1,14 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// "Lowish-layer" class definitions
+//
+
+#ifndef _CLS_H_
+#define _CLS_H_
+
+#include "dat.h"
+
+#endif
@@ -0,0 +1,314 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Lowest-layer plumbing and data structures
+//
+
+#ifndef _DAT_H_
+#define _DAT_H_
+
+#include <stddef.h>
+
+#include "module.h"
+#include "ztype.h"
+
+#include "dat/type.h"   // Types (must be included before other `dat` stuff).
+#include "dat/frame.h"  // Frame (stack reference) management.
+#include "dat/call.h"   // Function / method calling.
+
+
+//
+// Structures and constants
+//
+
+enum {
+    /**
+     * Number of entries in the inline method cache of each call site that
+     * has one.
+     */
+    DAT_CALL_CACHE_SIZE = 4
+};
+
+/**
+ * Partial definition of `DatHeader`, so that `classOf` and `datPayload`
+ * can be defined as inlines.
+ *
+ * * **Note:** This must match the definition of `DatHeader` in `dat/impl.h`.
+ */
+typedef struct {
+    zvalue cls;
+    int private1 : 1;
+    void *payload[/*flexible*/];
+} DatHeaderExposed;
+
+/**
+ * Declarative description of where a class's payload holds references to
+ * other values. A class with a layout (see `classSetGcLayout()`) gets traced
+ * directly by the garbage collector, without a `gcMark()` method call.
+ *
+ * A layout consists of a set of fixed reference fields, along with an
+ * optional array of elements each of which starts with some number of
+ * references. Fields left out of an initializer default to "none."
+ *
+ * Layouts also identify any other pointers in the payload, so that heap
+ * images (see `datImageSave()`) can relocate them. Classes without a layout
+ * are taken to have no pointers at all in their payloads.
+ */
+typedef struct {
+    /**
+     * Bit mask of fixed reference fields, where bit `n` corresponds to
+     * the payload slot at offset `n * sizeof(zvalue)`. Built using
+     * `DAT_GC_FIELD()`.
+     */
+    uint64_t fields;
+
+    /**
+     * Bit mask (as with `fields`) of slots that point *into* values, that
+     * is, at this value's own payload or that of a value it refers to. These
+     * aren't traced.
+     */
+    uint64_t pointers;
+
+    /**
+     * Bit mask (as with `fields`) of slots that point at static code or
+     * data. These aren't traced.
+     */
+    uint64_t statics;
+
+    /**
+     * Number of references at the start of each array element. `0` indicates
+     * that there is no array.
+     */
+    zint elementRefs;
+
+    /** Size in bytes of each array element. */
+    zint elementSize;
+
+    /** Payload offset of the array. */
+    zint arrayOffset;
+
+    /**
+     * Whether `arrayOffset` is the offset of a *pointer* to the array,
+     * as opposed to the offset of the array itself.
+     */
+    bool arrayIndirect;
+
+    /** Payload offset of the `zint` count of array elements. */
+    zint countOffset;
+
+    /**
+     * Fixed count of array elements. If non-zero, this is used instead of
+     * the count at `countOffset`.
+     */
+    zint elementCount;
+} zgcLayout;
+
+/**
+ * Gets the `zgcLayout` bit corresponding to the given payload field. The
+ * field must be pointer-sized and pointer-aligned.
+ */
+#define DAT_GC_FIELD(type, field) \
+    (((uint64_t) 1) << (offsetof(type, field) / sizeof(zvalue)))
+
+
+//
+// Assertion Declarations
+//
+
+/**
+ * Asserts that the given value is a valid `zvalue` (non-`NULL` and
+ * seems to actually have the right form). This performs reasonable,
+ * but not exhaustive, tests. If not valid, this aborts the process
+ * with a diagnostic message.
+ */
+void assertValid(zvalue value);
+
+/**
+ * Like `assertValid` except that `NULL` is accepted too.
+ */
+void assertValidOrNull(zvalue value);
+
+
+//
+// Code Loading Declarations
+//
+
+/**
+ * Loads and evaluates (runs) a native binary module, passing the given
+ * `env` argument to its `eval` function. `path` indicates the filesystem
+ * path to the module. This function returns whatever was returned by the
+ * `eval` function.
+ */
+zvalue datEvalBinary(zvalue env, zvalue path);
+
+
+//
+// Heap Image Declarations
+//
+
+/**
+ * Takes note of the current state of the heap as the "base" of a heap image.
+ * A heap image holds just the values that were created after its base, and
+ * it can only be loaded into a process whose heap is in the identical base
+ * state. In practice, this means that this function should be called at the
+ * same point (e.g. just after all modules are initialized) in both the
+ * process that saves an image and the processes that load it.
+ */
+void datImageBase(void);
+
+/**
+ * Loads the heap image at the given `path`, returning the root value that
+ * was passed to `datImageSave()`. `stamp` must match the value passed when
+ * saving. Returns `NULL` without having any other effect if the image
+ * doesn't exist or can't be used (e.g., because it is stale or corrupt, or
+ * because the binary running this code can't be identified).
+ * The result is added to the live reference stack.
+ */
+zvalue datImageLoad(const char *path, zint stamp);
+
+/**
+ * Saves a heap image to the given `path`, consisting of all the values
+ * (created since the call to `datImageBase()`) that are reachable from
+ * `root` or were made immortal. `stamp` is an arbitrary value used to
+ * identify the circumstances under which the image is valid. Returns `true`
+ * if the image was successfully saved, or `false` if not. An image can't be
+ * saved if any values that existed as of the base have since been modified
+ * to refer to newer ones, nor if the binary running this code can't be
+ * identified (since an image is only valid for the build that saved it).
+ */
+bool datImageSave(const char *path, zint stamp, zvalue root);
+
+
+//
+// Memory Management Declarations
+//
+
+/**
+ * Allocates a value, assigning it the given class, and sizing the memory
+ * to include the given amount of extra bytes as raw payload data.
+ * The resulting value is added to the live reference stack.
+ */
+zvalue datAllocValue(zvalue cls, zint extraBytes);
+
+/**
+ * Number of bytes of storage needed for a stack value (see
+ * `datInitStackValue()`) with the given amount of extra payload bytes.
+ */
+#define DAT_STACK_VALUE_SIZE(extraBytes) \
+    (offsetof(DatHeaderExposed, payload) + (extraBytes))
+
+/**
+ * Sets up a value of the given class in the given storage, which must be
+ * `zvalue`-aligned and at least `DAT_STACK_VALUE_SIZE(extraBytes)` bytes.
+ * This is meant for values that live on the C stack for the duration of a
+ * call. Such values aren't managed by the garbage collector at all, so they
+ * must never be referred to by other values, nor passed to any of the gc
+ * functions (including the write barriers), and anything they refer to must
+ * be kept alive by other means.
+ */
+zvalue datInitStackValue(void *storage, zvalue cls);
+
+/**
+ * Forces a gc.
+ */
+void datGc(void);
+
+/**
+ * Sets the gc tuning parameters. `growthFactor` is how big the heap may
+ * grow, as a multiple of the size that survived the last gc, before another
+ * gc is done; it must be at least `1`. `minBytes` is the minimum number of
+ * bytes to allow to be allocated between gcs. `maxBytes` is a hard ceiling
+ * on the size of the heap, past which the runtime terminates with an error;
+ * `0` means no ceiling. Passing a negative value for any argument leaves
+ * that parameter unchanged.
+ */
+void datGcConfigure(double growthFactor, zint minBytes, zint maxBytes);
+
+/**
+ * Sets the number of threads to use for the mark phase of gc, including the
+ * thread that triggered the gc. `0` means one per available CPU.
+ */
+void datGcSetMarkThreads(zint count);
+
+/**
+ * Sets whether full gcs are done incrementally, that is, in bounded slices
+ * interleaved with running the program, instead of all at once.
+ */
+void datGcSetIncremental(bool incremental);
+
+/**
+ * Marks the given value as "immortal." It is considered a root and
+ * will never get freed. Returns `value`, to aid in cascading calls (avoiding
+ * duplication).
+ */
+zvalue datImmortalize(zvalue value);
+
+/**
+ * Marks a value during garbage collection. This in turn calls a class-specific
+ * mark function when appropriate and may recurse arbitrarily. It is valid
+ * to pass `NULL` to this, but no other non-values are acceptable.
+ *
+ * Marking may be spread across several threads, so class-specific mark
+ * functions must do nothing but read their value and call this function.
+ */
+void datMark(zvalue value);
+
+/**
+ * Write barrier, which must be called just before `newValue` gets stored into
+ * `target` in place of `oldValue`, once `target` is fully constructed (e.g.
+ * storing into a `Cell`). This lets the collector find references from
+ * tenured values to nursery values, and keeps an incremental gc from losing
+ * track of `oldValue`. Writes into a value that is still being constructed
+ * (that is, while it is still on the frame stack of the function that
+ * allocated it) need not call this, so long as they only fill in fields that
+ * were `NULL`.
+ */
+void datWriteBarrier(zvalue target, zvalue oldValue, zvalue newValue);
+
+/**
+ * Like `datWriteBarrier()`, but for an arbitrary (or bulk) update of
+ * `target`. Must be called just before the update.
+ */
+void datWriteBarrierAll(zvalue target);
+
+/**
+ * Issues a fatal error about a void where a value was expected. This is used
+ * by `datNonVoid()`.
+ */
+void datNonVoidError(void)
+    __attribute__((noreturn));
+
+/**
+ * Checks that the given argument is non-void (that is not `NULL`), returning
+ * it unmodified if non-void, or terminating the runtime with an error if it
+ * is void.
+ *
+ * **Note:** This is not an `assert`, since it's meant to be used in a
+ * full "production" type build.
+ */
+inline zvalue datNonVoid(zvalue value) {
+    if (value == NULL) {
+        datNonVoidError();
+    }
+
+    return value;
+}
+
+/**
+ * Gets a pointer to the data payload of a `zvalue`.
+ */
+inline void *datPayload(zvalue value) {
+    return ((DatHeaderExposed *) (void *) value)->payload;
+}
+
+/**
+ * Gets the class of the given value. `value` must be a valid value (in
+ * particular, non-`NULL`). The return value is of class `Class`.
+ */
+inline zvalue classOf(zvalue value) {
+    return ((DatHeaderExposed *) (void *) value)->cls;
+}
+
+#endif
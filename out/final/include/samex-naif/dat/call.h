@@ -0,0 +1,237 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Function / method calling
+//
+
+#ifndef _DAT_CALL_H_
+#define _DAT_CALL_H_
+
+#include "util.h"
+
+/**
+ * Entry in an inline method cache: a receiver class, along with the
+ * function bound to the call site's method name in that class.
+ */
+typedef struct {
+    /** Class of the receiver. */
+    zvalue cls;
+
+    /** Function that the method resolves to. */
+    zvalue function;
+
+    /**
+     * Method binding epoch of `cls` as of the lookup. The entry is only
+     * valid while the class is still in the same epoch.
+     */
+    zint epoch;
+} zmethodCacheEntry;
+
+/**
+ * Inline method cache for a single call site, that is, for calls to a
+ * particular method name from a particular spot in code. This is meant to be
+ * embedded in the payload of a value (the "owner" of the cache), with the
+ * `entries` typically also part of that payload. The owner's gc layout is
+ * responsible for tracing the entries.
+ */
+typedef struct {
+    /** Number of calls that found their class in the cache. */
+    zint hits;
+
+    /** Number of calls that didn't find their class in the cache. */
+    zint misses;
+
+    /** Number of entries. `0` indicates a site which doesn't cache. */
+    zint size;
+
+    /** The entries, in order of filling. */
+    zmethodCacheEntry *entries;
+} zcallCache;
+
+/**
+ * Totals of inline method cache activity, across all call sites.
+ */
+typedef struct {
+    /** Calls that hit on the first entry of a cache. */
+    zint monomorphicHits;
+
+    /** Calls that hit on an entry other than the first. */
+    zint polymorphicHits;
+
+    /** Calls that missed, filling in an unused or stale entry. */
+    zint misses;
+
+    /** Calls that missed with all entries in use, replacing one. */
+    zint megamorphicMisses;
+} zcallCacheStats;
+
+/**
+ * Position in the call trace, for use with `methTraceReset()`.
+ */
+typedef struct {
+    /** Number of calls in progress. */
+    zint depth;
+
+    /** Top of the giblet stack. */
+    struct UtilStackGiblet *giblet;
+} ztraceMark;
+
+/**
+ * Call trace entry for a call that isn't made by one of the `methCall*()`
+ * functions. See `methTracePush()`.
+ */
+typedef struct {
+    /** Target being called. */
+    zvalue target;
+
+    /** Name of method being called. */
+    zvalue name;
+
+    /** Giblet for the entry. Only used when `DAT_FULL_TRACE` is on. */
+    UtilStackGiblet giblet;
+} ztraceEntry;
+
+/**
+ * Calls the method `name` on target `target`, with the given list of
+ * `args`. `name` must be a symbol, and `args` must be a list or `NULL` (the
+ * latter treated as the empty list).
+ */
+zvalue methApply(zvalue target, zvalue name, zvalue args);
+
+/**
+ * Calls the method `name` on target `target`, with the given list of
+ * `args`. `name` must be a symbol, and all elements of `args` must be
+ * non-`NULL`.
+ *
+ * **Note:** Since in the vast majority of cases it's statically known that
+ * `args[*]` is non-`NULL`, those checks are not performed here. If the
+ * checks in question need to be performed, then they need to be done on
+ * the caller side, e.g. with calls to `datNonVoid()`.
+ */
+zvalue methCall(zvalue target, zvalue name, zarray args);
+
+/**
+ * Like `methCall(target, SYM(call), args)`, for a `target` which is known
+ * to be an instance of class `Builtin`. This skips the method lookup and
+ * invokes the builtin's function directly, while still recording the call in
+ * the call trace.
+ */
+zvalue methCallBuiltin(zvalue target, zarray args);
+
+/**
+ * Gets the totals of inline method cache activity so far.
+ */
+zcallCacheStats methCallCacheStats(void);
+
+/**
+ * Like `methCall()`, but consulting and updating the given inline method
+ * cache, which belongs to the value `owner`. All calls made through a given
+ * cache must use the same `name`.
+ */
+zvalue methCallCached(zvalue owner, zcallCache *cache, zvalue target,
+        zvalue name, zarray args);
+
+/**
+ * Gets the current position in the call trace.
+ */
+ztraceMark methTraceMark(void);
+
+/**
+ * Records a call of `name` on `target` in the call trace, as the innermost
+ * call in progress, using `entry` as storage. This is for callers that make
+ * calls without using the `methCall*()` functions, such as the bytecode
+ * virtual machine. `entry` has to stay put until the call is over, at which
+ * point the caller resets the trace to what it was before the push (see
+ * `methTraceReset()`).
+ */
+void methTracePush(ztraceEntry *entry, zvalue target, zvalue name);
+
+/**
+ * Replaces the innermost call in the call trace with a call of `name` on
+ * `target`. This is used when a call in tail position gets made in place
+ * of the one that made it.
+ */
+void methTraceReplace(zvalue target, zvalue name);
+
+/**
+ * Resets the call trace to the given position, which must have been
+ * obtained from an outer call. This is used when a nonlocal exit skips
+ * over calls without returning from them.
+ */
+void methTraceReset(ztraceMark mark);
+
+/**
+ * Function which should never get called. This is used to wrap calls which
+ * aren't allowed to return. Should they return, this function gets called
+ * and promptly dies with a fatal error.
+ *
+ * **Note:** This function is typed to return a `zvalue` (and not void),
+ * so that it can be used in contexts that require a return value. This is
+ * a quirk of the `noreturn` extension to C, which this function uses.
+ */
+zvalue mustNotYield(zvalue value)
+    __attribute__((noreturn));
+
+/**
+ * Gets all the arguments passed to a `zfunction` (that is, `first` followed
+ * by `rest`) as a single array. `elems` is used as storage for the result
+ * if necessary, and must have room for `rest.size + 1` elements.
+ */
+zarray zarrayFromArgs(zvalue first, zarray rest, zvalue *elems);
+
+
+//
+// Function / method calling macros
+//
+// See <https://stackoverflow.com/questions/26497854/> for info about how
+// the varargs macros work. There's some additional history at
+// <http://stackoverflow.com/questions/2632300> and
+// <http://stackoverflow.com/questions/1872220>.
+//
+
+/**
+ * Helper for call macros: Construct an inline `zvalue[]` for all given
+ * arguments.
+ */
+#define CALL_ARG_ARRAY(...) ((zvalue[]) { __VA_ARGS__ })
+
+/**
+ * Helper for call macros: Get the number of arguments.
+ */
+#define CALL_ARG_COUNT(...) \
+    (sizeof (CALL_ARG_ARRAY(__VA_ARGS__)) / sizeof (zvalue))
+
+/**
+ * `FUN_CALL(function, arg, ...)`: Calls a function, with a variable number
+ * of arguments passed in the usual C style.
+ */
+#define FUN_CALL(func, ...) \
+    methCall(func, SYM(call), \
+        (zarray) {CALL_ARG_COUNT(__VA_ARGS__), CALL_ARG_ARRAY(__VA_ARGS__)})
+
+/**
+ * `METH_APPLY(target, name, args)`: Calls a method by (unadorned) name,
+ * with a variable number of arguments passed as a list.
+ */
+#define METH_APPLY(target, name, args) methApply((target), SYM(name), (args))
+
+/**
+ * `METH_CALL_SYM(target, name, arg, ...)`: Calls a method on a given `target`
+ * given a symbol name, with a variable number of arguments passed in the
+ * usual C style.
+ */
+#define METH_CALL_SYM(target, name, ...) \
+    methCall((target), name, \
+        (zarray) {CALL_ARG_COUNT(__VA_ARGS__), CALL_ARG_ARRAY(__VA_ARGS__)})
+
+/**
+ * `METH_CALL(target, name, arg, ...)`: Calls a method on a given `target`
+ * by (unadorned) name, with a variable number of arguments passed in the
+ * usual C style.
+ */
+#define METH_CALL(target, name, ...) \
+    METH_CALL_SYM(target, SYM(name), __VA_ARGS__)
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Frame (stack references) management
+//
+// The stack is made of a chain of segments, which get added as needed. Only
+// the segment holding the top of the stack is described by the variables
+// below; all the segments before it are always full.
+//
+
+#ifndef _DAT_FRAME_H_
+#define _DAT_FRAME_H_
+
+
+//
+// Private Definitions
+//
+
+/** Base of the current stack segment (builds forward in memory). */
+extern zstackPointer frameStackBase;
+
+/** Points at the location for the next `add`. */
+extern zstackPointer frameStackTop;
+
+/**
+ * Limit of the current stack segment (highest possible value for
+ * `frameStackTop`).
+ */
+extern zstackPointer frameStackLimit;
+
+/** Indicates a fatal error. */
+void datFrameError(const char *message)
+    __attribute__((noreturn));
+
+/**
+ * Moves on to the next stack segment, making one if necessary. Called when
+ * the current segment is full.
+ */
+void datFrameGrow(void);
+
+/**
+ * Returns to the given stack pointer, which is in an earlier stack segment
+ * than the current one.
+ */
+void datFrameUnwind(zstackPointer savedStack);
+
+
+//
+// Public Definitions
+//
+
+/**
+ * Adds an item to the current frame and returns it. This is only necessary to
+ * call when a reference gets "detached" from a structure (e.g. returning
+ * an element out of a collection, where it is not known that the collection
+ * will remain live after the call) and either returned from a C function
+ * (but not an in-model function or method call) or stored in a structure that
+ * GC won't immediately find.
+ */
+inline zvalue datFrameAdd(zvalue value) {
+    if (value == NULL) {
+        return NULL;
+    } else if (frameStackTop == frameStackLimit) {
+        datFrameGrow();
+    }
+
+    *frameStackTop = value;
+    frameStackTop++;
+    return value;
+}
+
+/**
+ * Indicates the start of a new frame of references on the stack.
+ * The return value can subsequently be passed to `datFrameEnd` to
+ * indicate that this frame is no longer active.
+ */
+inline zstackPointer datFrameStart(void) {
+    return frameStackTop;
+}
+
+/**
+ * Indicates that the frame whose start returned the given stack pointer
+ * is no longer active. If the given additional value is non-`NULL` it is
+ * added to the frame being "returned" to. It is valid to return to any
+ * frame above the current one, not just the immediately-previous frame;
+ * non-immediate return can happen during a nonlocal exit.
+ */
+inline void datFrameReturn(zstackPointer savedStack, zvalue returnValue) {
+    if ((savedStack >= frameStackBase) && (savedStack <= frameStackTop)) {
+        frameStackTop = savedStack;
+    } else {
+        datFrameUnwind(savedStack);
+    }
+
+    datFrameAdd(returnValue);
+}
+
+#endif
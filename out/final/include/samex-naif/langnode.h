@@ -0,0 +1,18 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Executable tree node construction and manipulation
+//
+
+#ifndef _LANGNODE_H_
+#define _LANGNODE_H_
+
+#include "type/Value.h"
+
+#include "langnode/type.h"
+#include "langnode/consts.h"
+#include "langnode/functions.h"
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Core` class
+//
+
+#ifndef _TYPE_CORE_H_
+#define _TYPE_CORE_H_
+
+#include "type/Value.h"
+
+
+/** Class value for in-model class `Core`. */
+extern zvalue CLS_Core;
+
+#endif
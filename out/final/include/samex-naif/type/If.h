@@ -0,0 +1,18 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `If` class
+//
+
+#ifndef _TYPE_IF_H_
+#define _TYPE_IF_H_
+
+#include "type/Core.h"
+
+
+/** Class value for in-model class `If`. */
+extern zvalue CLS_If;
+
+#endif
@@ -0,0 +1,50 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Int` class
+//
+
+#ifndef _TYPE_INT_H_
+#define _TYPE_INT_H_
+
+#include "type/Core.h"
+
+
+/** Class value for in-model class `Int`. */
+extern zvalue CLS_Int;
+
+/** The standard value `0`. */
+extern zvalue INT_0;
+
+/** The standard value `1`. */
+extern zvalue INT_1;
+
+/** The standard value `-1`. */
+extern zvalue INT_NEG1;
+
+/**
+ * Gets an int value equal to the given `zint`. In this
+ * implementation, ints are restricted to only taking on the range
+ * of 64-bit signed twos-complement integers.
+ */
+zvalue intFromZint(zint value);
+
+/**
+ * Calls the method `name` on the int `target` with the given `args`, for the
+ * methods which are pure arithmetic on ints (such as `add` and `neg`).
+ * Unlike calling the method, this never fails: It returns `NULL` if `name`
+ * isn't one of those methods taking `args.size` arguments, if an argument
+ * isn't an int, or if the operation overflows or is otherwise invalid (such
+ * as division by zero).
+ */
+zvalue intTryCall(zvalue target, zvalue name, zarray args);
+
+/**
+ * Gets a `zint` equal to the given int value. `intval` must be an
+ * int. It is an error if the value is out of range.
+ */
+zint zintFromInt(zvalue intval);
+
+#endif
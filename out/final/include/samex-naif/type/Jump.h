@@ -0,0 +1,98 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Jump` class
+//
+
+#ifndef _TYPE_JUMP_H_
+#define _TYPE_JUMP_H_
+
+// Needed for `sigjmp_buf` when using glibc.
+//
+// Note: Rather than define this directly here, the following setup causes the
+// compiler to bail if the source that `#include`s this file fails to define
+// the constant appropriately. This avoids having the feature macro defined
+// inconsistently within a single file.
+#ifndef _XOPEN_SOURCE
+#error Jump.h requires: `#define _XOPEN_SOURCE 700`
+#elif _XOPEN_SOURCE != 700
+#error Jump.h requires: `#define _XOPEN_SOURCE 700`
+#endif
+
+#include <setjmp.h>
+#include <stdbool.h>
+
+#include "type/Value.h"
+
+
+/** Class value for in-model class `Jump`. */
+extern zvalue CLS_Jump;
+
+/**
+ * Return point of nonlocal jumps. These live on the C stack of the function
+ * being jumped out of, and are only valid between `jumpArm()` and
+ * `jumpRetire()`. Any number of `Jump`s can share a single target. This is
+ * defined here so that the exported macros can access it.
+ */
+typedef struct JumpTarget {
+    /** Environment struct for use with `sigsetjmp` et al. */
+    sigjmp_buf env;
+
+    /** Unique identifier, which is how `Jump`s refer to this target. */
+    zint id;
+
+    /** Next outer target that is armed, if any. */
+    struct JumpTarget *outer;
+
+    /** What to return when jumped to. */
+    zvalue result;
+} JumpTarget;
+
+/** Innermost armed jump target, if any. */
+extern JumpTarget *jumpTargetTop;
+
+/**
+ * Constructs and returns a nonlocal jump to the given target, which must be
+ * armed. The jump is valid for use until the target is retired. `voidOk`
+ * indicates whether the jump may be made without a value.
+ */
+zvalue makeJump(JumpTarget *target, bool voidOk);
+
+/**
+ * Gives the given target a new identifier, and makes it the innermost armed
+ * one. This is just the part of `jumpArm()` which doesn't need to be in a
+ * macro.
+ */
+void jumpPush(JumpTarget *target);
+
+/**
+ * Sets up the given target as a nonlocal jump point, and makes it the
+ * innermost armed target. It must be retired (with `jumpRetire()`) before
+ * the function using this macro returns normally.
+ */
+#define jumpArm(target) \
+    do { \
+        zstackPointer save = datFrameStart(); \
+        ztraceMark traceSave = methTraceMark(); \
+        if (sigsetjmp((target)->env, 0)) { \
+            zvalue result = (target)->result; \
+            jumpTargetTop = (target)->outer; \
+            methTraceReset(traceSave); \
+            datFrameReturn(save, result); \
+            return result; \
+        } \
+        jumpPush((target)); \
+    } while (0)
+
+/**
+ * Retires (invalidates) the given target, which must be the innermost armed
+ * one. After this, jumps to it are out-of-scope.
+ */
+#define jumpRetire(target) \
+    do { \
+        jumpTargetTop = (target)->outer; \
+    } while (0)
+
+#endif
@@ -0,0 +1,21 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Null` class
+//
+
+#ifndef _TYPE_NULL_H_
+#define _TYPE_NULL_H_
+
+#include "type/Core.h"
+
+
+/** Class value for in-model class `Null`. */
+extern zvalue CLS_Null;
+
+/** The standard value `null`. */
+extern zvalue THE_NULL;
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Object` class
+//
+
+#ifndef _TYPE_OBJECT_H_
+#define _TYPE_OBJECT_H_
+
+#include "type/Value.h"
+
+
+/** Class value for in-model class `Object`. */
+extern zvalue CLS_Object;
+
+#endif
@@ -0,0 +1,26 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Value` base class
+//
+// **Note:** As a slight concession to conciseness, the name prefix used for
+// this class is `val` and not `value`.
+//
+
+#ifndef _TYPE_VALUE_H_
+#define _TYPE_VALUE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "type/declare.h"
+#include "type/methodCalls.h"
+#include "type/symbols.h"
+
+
+/** Class value for in-model class `Value`. */
+extern zvalue CLS_Value;
+
+#endif
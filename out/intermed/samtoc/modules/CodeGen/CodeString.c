@@ -0,0 +1,2607 @@
+// GENERATED CODE!
+// GENERATED CODE!
+// GENERATED CODE!
+//
+// This code *might* be derived from a copyrighted source. Proceed with
+// caution!
+
+#include "type/Bool.h"
+#include "type/Class.h"
+#include "type/Cmp.h"
+#include "type/If.h"
+#include "type/Int.h"
+#include "type/List.h"
+#include "type/Map.h"
+#include "type/Null.h"
+#include "type/Object.h"
+#include "type/Record.h"
+#include "type/String.h"
+#include "type/Symbol.h"
+#include "type/SymbolTable.h"
+#include "util.h"
+
+static zvalue programTree(void) {
+  return
+    methCall(
+      CLS_Record,
+      SYM(new),
+      (zarray) {2,
+      (zvalue[]) {
+        symbolFromUtf8(7, "closure"),
+        methCall(
+          CLS_SymbolTable,
+          SYM(new),
+          (zarray) {8,
+          (zvalue[]) {
+            symbolFromUtf8(7, "formals"),
+            EMPTY_LIST,
+            symbolFromUtf8(4, "info"),
+            methCall(
+              CLS_SymbolTable,
+              SYM(new),
+              (zarray) {6,
+              (zvalue[]) {
+                symbolFromUtf8(7, "exports"),
+                methCall(
+                  CLS_Map,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(10, "CodeString"),
+                    CLS_Value}}),
+                symbolFromUtf8(7, "imports"),
+                methCall(
+                  CLS_Map,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    methCall(
+                      CLS_Record,
+                      SYM(new),
+                      (zarray) {2,
+                      (zvalue[]) {
+                        symbolFromUtf8(8, "internal"),
+                        methCall(
+                          CLS_SymbolTable,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "name"),
+                            stringFromUtf8(11, "indentation")}})}}),
+                    methCall(
+                      CLS_Map,
+                      SYM(new),
+                      (zarray) {2,
+                      (zvalue[]) {
+                        symbolFromUtf8(11, "INDENTATION"),
+                        CLS_Value}})}}),
+                symbolFromUtf8(9, "resources"),
+                EMPTY_MAP}}),
+            symbolFromUtf8(10, "statements"),
+            methCall(
+              CLS_List,
+              SYM(new),
+              (zarray) {5,
+              (zvalue[]) {
+                methCall(
+                  CLS_Record,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(6, "varDef"),
+                    methCall(
+                      CLS_SymbolTable,
+                      SYM(new),
+                      (zarray) {6,
+                      (zvalue[]) {
+                        symbolFromUtf8(3, "box"),
+                        symbolFromUtf8(7, "promise"),
+                        symbolFromUtf8(4, "name"),
+                        symbolFromUtf8(10, "CodeString"),
+                        symbolFromUtf8(5, "value"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {1,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "void")}})}})}}),
+                methCall(
+                  CLS_Record,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(21, "importModuleSelection"),
+                    methCall(
+                      CLS_SymbolTable,
+                      SYM(new),
+                      (zarray) {4,
+                      (zvalue[]) {
+                        symbolFromUtf8(6, "select"),
+                        methCall(
+                          CLS_List,
+                          SYM(new),
+                          (zarray) {1,
+                          (zvalue[]) {
+                            symbolFromUtf8(11, "INDENTATION")}}),
+                        symbolFromUtf8(6, "source"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(8, "internal"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {2,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                stringFromUtf8(11, "indentation")}})}})}})}}),
+                methCall(
+                  CLS_Record,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(6, "varDef"),
+                    methCall(
+                      CLS_SymbolTable,
+                      SYM(new),
+                      (zarray) {6,
+                      (zvalue[]) {
+                        symbolFromUtf8(3, "box"),
+                        symbolFromUtf8(6, "result"),
+                        symbolFromUtf8(4, "name"),
+                        symbolFromUtf8(6, "ACCESS"),
+                        symbolFromUtf8(5, "value"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "call"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {6,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(10, "toUnlisted")}})}}),
+                                symbolFromUtf8(6, "target"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(6, "ACCESS")}})}}),
+                                symbolFromUtf8(6, "values"),
+                                EMPTY_LIST}})}})}})}}),
+                methCall(
+                  CLS_Record,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(6, "varDef"),
+                    methCall(
+                      CLS_SymbolTable,
+                      SYM(new),
+                      (zarray) {6,
+                      (zvalue[]) {
+                        symbolFromUtf8(3, "box"),
+                        symbolFromUtf8(6, "result"),
+                        symbolFromUtf8(4, "name"),
+                        symbolFromUtf8(3, "NEW"),
+                        symbolFromUtf8(5, "value"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "call"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {6,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(10, "toUnlisted")}})}}),
+                                symbolFromUtf8(6, "target"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(3, "NEW")}})}}),
+                                symbolFromUtf8(6, "values"),
+                                EMPTY_LIST}})}})}})}}),
+                methCall(
+                  CLS_Record,
+                  SYM(new),
+                  (zarray) {2,
+                  (zvalue[]) {
+                    symbolFromUtf8(5, "store"),
+                    methCall(
+                      CLS_SymbolTable,
+                      SYM(new),
+                      (zarray) {4,
+                      (zvalue[]) {
+                        symbolFromUtf8(6, "target"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(6, "varRef"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {2,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                symbolFromUtf8(10, "CodeString")}})}}),
+                        symbolFromUtf8(5, "value"),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "call"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {6,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(8, "subclass")}})}}),
+                                symbolFromUtf8(6, "target"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        CLS_Object}})}}),
+                                symbolFromUtf8(6, "values"),
+                                methCall(
+                                  CLS_List,
+                                  SYM(new),
+                                  (zarray) {4,
+                                  (zvalue[]) {
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(7, "literal"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {2,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(5, "value"),
+                                            symbolFromUtf8(10, "CodeString")}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(4, "call"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {6,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(4, "name"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    symbolFromUtf8(3, "new")}})}}),
+                                            symbolFromUtf8(6, "target"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    CLS_SymbolTable}})}}),
+                                            symbolFromUtf8(6, "values"),
+                                            methCall(
+                                              CLS_List,
+                                              SYM(new),
+                                              (zarray) {4,
+                                              (zvalue[]) {
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "access")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "fetch"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "target"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              6,
+                                                              "varRef"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "ACCESS")}})}})}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          3,
+                                                          "new")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "fetch"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "target"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              6,
+                                                              "varRef"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                symbolFromUtf8(
+                                                                  3,
+                                                                  "NEW")}})}})}})}})}})}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(4, "call"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {6,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(4, "name"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    symbolFromUtf8(3, "new")}})}}),
+                                            symbolFromUtf8(6, "target"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    CLS_SymbolTable}})}}),
+                                            symbolFromUtf8(6, "values"),
+                                            methCall(
+                                              CLS_List,
+                                              SYM(new),
+                                              (zarray) {4,
+                                              (zvalue[]) {
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          3,
+                                                          "new")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "closure"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {8,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "formals"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "this")}})}}),
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "text")}})}})}}),
+                                                        symbolFromUtf8(
+                                                          4,
+                                                          "name"),
+                                                        symbolFromUtf8(
+                                                          3,
+                                                          "new"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "statements"),
+                                                        EMPTY_LIST,
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "yield"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              4,
+                                                              "call"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {6,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "fetch"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "target"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "varRef"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "name"),
+                                                                                symbolFromUtf8(
+                                                                                  3,
+                                                                                  "NEW")}})}})}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "target"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "fetch"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "target"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "varRef"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "name"),
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "this")}})}})}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "values"),
+                                                                methCall(
+                                                                  CLS_List,
+                                                                  SYM(new),
+                                                                  (zarray) {1,
+                                                                  (zvalue[]) {
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          4,
+                                                                          "call"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {6,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              4,
+                                                                              "name"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  7,
+                                                                                  "literal"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      5,
+                                                                                      "value"),
+                                                                                    symbolFromUtf8(
+                                                                                      3,
+                                                                                      "new")}})}}),
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "target"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  7,
+                                                                                  "literal"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      5,
+                                                                                      "value"),
+                                                                                    CLS_SymbolTable}})}}),
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "values"),
+                                                                            methCall(
+                                                                              CLS_List,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                methCall(
+                                                                                  CLS_Record,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      7,
+                                                                                      "literal"),
+                                                                                    methCall(
+                                                                                      CLS_SymbolTable,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          5,
+                                                                                          "value"),
+                                                                                        symbolFromUtf8(
+                                                                                          4,
+                                                                                          "text")}})}}),
+                                                                                methCall(
+                                                                                  CLS_Record,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      5,
+                                                                                      "fetch"),
+                                                                                    methCall(
+                                                                                      CLS_SymbolTable,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          6,
+                                                                                          "target"),
+                                                                                        methCall(
+                                                                                          CLS_Record,
+                                                                                          SYM(new),
+                                                                                          (zarray) {2,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              6,
+                                                                                              "varRef"),
+                                                                                            methCall(
+                                                                                              CLS_SymbolTable,
+                                                                                              SYM(new),
+                                                                                              (zarray) {2,
+                                                                                              (zvalue[]) {
+                                                                                                symbolFromUtf8(
+                                                                                                  4,
+                                                                                                  "name"),
+                                                                                                symbolFromUtf8(
+                                                                                                  4,
+                                                                                                  "text")}})}})}})}})}})}})}})}})}})}})}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          3,
+                                                          "fix")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "closure"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {8,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "formals"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "this")}})}}),
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      12,
+                                                                      "treeOrString")}})}})}}),
+                                                        symbolFromUtf8(
+                                                          4,
+                                                          "name"),
+                                                        symbolFromUtf8(
+                                                          3,
+                                                          "fix"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "statements"),
+                                                        EMPTY_LIST,
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "yield"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              4,
+                                                              "call"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {6,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      7,
+                                                                      "literal"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          5,
+                                                                          "value"),
+                                                                        symbolFromUtf8(
+                                                                          2,
+                                                                          "or")}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "target"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      7,
+                                                                      "literal"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          5,
+                                                                          "value"),
+                                                                        CLS_If}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "values"),
+                                                                methCall(
+                                                                  CLS_List,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          7,
+                                                                          "closure"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {6,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              7,
+                                                                              "formals"),
+                                                                            EMPTY_LIST,
+                                                                            symbolFromUtf8(
+                                                                              10,
+                                                                              "statements"),
+                                                                            EMPTY_LIST,
+                                                                            symbolFromUtf8(
+                                                                              5,
+                                                                              "yield"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "maybe"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      5,
+                                                                                      "value"),
+                                                                                    methCall(
+                                                                                      CLS_Record,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          4,
+                                                                                          "call"),
+                                                                                        methCall(
+                                                                                          CLS_SymbolTable,
+                                                                                          SYM(new),
+                                                                                          (zarray) {6,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              4,
+                                                                                              "name"),
+                                                                                            methCall(
+                                                                                              CLS_Record,
+                                                                                              SYM(new),
+                                                                                              (zarray) {2,
+                                                                                              (zvalue[]) {
+                                                                                                symbolFromUtf8(
+                                                                                                  7,
+                                                                                                  "literal"),
+                                                                                                methCall(
+                                                                                                  CLS_SymbolTable,
+                                                                                                  SYM(new),
+                                                                                                  (zarray) {2,
+                                                                                                  (zvalue[]) {
+                                                                                                    symbolFromUtf8(
+                                                                                                      5,
+                                                                                                      "value"),
+                                                                                                    symbolFromUtf8(
+                                                                                                      5,
+                                                                                                      "value")}})}}),
+                                                                                            symbolFromUtf8(
+                                                                                              6,
+                                                                                              "target"),
+                                                                                            methCall(
+                                                                                              CLS_Record,
+                                                                                              SYM(new),
+                                                                                              (zarray) {2,
+                                                                                              (zvalue[]) {
+                                                                                                symbolFromUtf8(
+                                                                                                  7,
+                                                                                                  "literal"),
+                                                                                                methCall(
+                                                                                                  CLS_SymbolTable,
+                                                                                                  SYM(new),
+                                                                                                  (zarray) {2,
+                                                                                                  (zvalue[]) {
+                                                                                                    symbolFromUtf8(
+                                                                                                      5,
+                                                                                                      "value"),
+                                                                                                    CLS_If}})}}),
+                                                                                            symbolFromUtf8(
+                                                                                              6,
+                                                                                              "values"),
+                                                                                            methCall(
+                                                                                              CLS_List,
+                                                                                              SYM(new),
+                                                                                              (zarray) {2,
+                                                                                              (zvalue[]) {
+                                                                                                methCall(
+                                                                                                  CLS_Record,
+                                                                                                  SYM(new),
+                                                                                                  (zarray) {2,
+                                                                                                  (zvalue[]) {
+                                                                                                    symbolFromUtf8(
+                                                                                                      7,
+                                                                                                      "closure"),
+                                                                                                    methCall(
+                                                                                                      CLS_SymbolTable,
+                                                                                                      SYM(new),
+                                                                                                      (zarray) {6,
+                                                                                                      (zvalue[]) {
+                                                                                                        symbolFromUtf8(
+                                                                                                          7,
+                                                                                                          "formals"),
+                                                                                                        EMPTY_LIST,
+                                                                                                        symbolFromUtf8(
+                                                                                                          10,
+                                                                                                          "statements"),
+                                                                                                        EMPTY_LIST,
+                                                                                                        symbolFromUtf8(
+                                                                                                          5,
+                                                                                                          "yield"),
+                                                                                                        methCall(
+                                                                                                          CLS_Record,
+                                                                                                          SYM(new),
+                                                                                                          (zarray) {2,
+                                                                                                          (zvalue[]) {
+                                                                                                            symbolFromUtf8(
+                                                                                                              5,
+                                                                                                              "maybe"),
+                                                                                                            methCall(
+                                                                                                              CLS_SymbolTable,
+                                                                                                              SYM(new),
+                                                                                                              (zarray) {2,
+                                                                                                              (zvalue[]) {
+                                                                                                                symbolFromUtf8(
+                                                                                                                  5,
+                                                                                                                  "value"),
+                                                                                                                methCall(
+                                                                                                                  CLS_Record,
+                                                                                                                  SYM(new),
+                                                                                                                  (zarray) {2,
+                                                                                                                  (zvalue[]) {
+                                                                                                                    symbolFromUtf8(
+                                                                                                                      4,
+                                                                                                                      "call"),
+                                                                                                                    methCall(
+                                                                                                                      CLS_SymbolTable,
+                                                                                                                      SYM(new),
+                                                                                                                      (zarray) {6,
+                                                                                                                      (zvalue[]) {
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          4,
+                                                                                                                          "name"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_Record,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {2,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            symbolFromUtf8(
+                                                                                                                              7,
+                                                                                                                              "literal"),
+                                                                                                                            methCall(
+                                                                                                                              CLS_SymbolTable,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  5,
+                                                                                                                                  "value"),
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  7,
+                                                                                                                                  "accepts")}})}}),
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          6,
+                                                                                                                          "target"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_Record,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {2,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            symbolFromUtf8(
+                                                                                                                              5,
+                                                                                                                              "fetch"),
+                                                                                                                            methCall(
+                                                                                                                              CLS_SymbolTable,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  6,
+                                                                                                                                  "target"),
+                                                                                                                                methCall(
+                                                                                                                                  CLS_Record,
+                                                                                                                                  SYM(new),
+                                                                                                                                  (zarray) {2,
+                                                                                                                                  (zvalue[]) {
+                                                                                                                                    symbolFromUtf8(
+                                                                                                                                      6,
+                                                                                                                                      "varRef"),
+                                                                                                                                    methCall(
+                                                                                                                                      CLS_SymbolTable,
+                                                                                                                                      SYM(new),
+                                                                                                                                      (zarray) {2,
+                                                                                                                                      (zvalue[]) {
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          4,
+                                                                                                                                          "name"),
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          6,
+                                                                                                                                          "String")}})}})}})}}),
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          6,
+                                                                                                                          "values"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_List,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {1,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            methCall(
+                                                                                                                              CLS_Record,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  5,
+                                                                                                                                  "fetch"),
+                                                                                                                                methCall(
+                                                                                                                                  CLS_SymbolTable,
+                                                                                                                                  SYM(new),
+                                                                                                                                  (zarray) {2,
+                                                                                                                                  (zvalue[]) {
+                                                                                                                                    symbolFromUtf8(
+                                                                                                                                      6,
+                                                                                                                                      "target"),
+                                                                                                                                    methCall(
+                                                                                                                                      CLS_Record,
+                                                                                                                                      SYM(new),
+                                                                                                                                      (zarray) {2,
+                                                                                                                                      (zvalue[]) {
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          6,
+                                                                                                                                          "varRef"),
+                                                                                                                                        methCall(
+                                                                                                                                          CLS_SymbolTable,
+                                                                                                                                          SYM(new),
+                                                                                                                                          (zarray) {2,
+                                                                                                                                          (zvalue[]) {
+                                                                                                                                            symbolFromUtf8(
+                                                                                                                                              4,
+                                                                                                                                              "name"),
+                                                                                                                                            symbolFromUtf8(
+                                                                                                                                              12,
+                                                                                                                                              "treeOrString")}})}})}})}})}})}})}})}})}})}})}}),
+                                                                                                methCall(
+                                                                                                  CLS_Record,
+                                                                                                  SYM(new),
+                                                                                                  (zarray) {2,
+                                                                                                  (zvalue[]) {
+                                                                                                    symbolFromUtf8(
+                                                                                                      7,
+                                                                                                      "closure"),
+                                                                                                    methCall(
+                                                                                                      CLS_SymbolTable,
+                                                                                                      SYM(new),
+                                                                                                      (zarray) {6,
+                                                                                                      (zvalue[]) {
+                                                                                                        symbolFromUtf8(
+                                                                                                          7,
+                                                                                                          "formals"),
+                                                                                                        methCall(
+                                                                                                          CLS_List,
+                                                                                                          SYM(new),
+                                                                                                          (zarray) {1,
+                                                                                                          (zvalue[]) {
+                                                                                                            methCall(
+                                                                                                              CLS_Record,
+                                                                                                              SYM(new),
+                                                                                                              (zarray) {1,
+                                                                                                              (zvalue[]) {
+                                                                                                                symbolFromUtf8(
+                                                                                                                  6,
+                                                                                                                  "formal")}})}}),
+                                                                                                        symbolFromUtf8(
+                                                                                                          10,
+                                                                                                          "statements"),
+                                                                                                        EMPTY_LIST,
+                                                                                                        symbolFromUtf8(
+                                                                                                          5,
+                                                                                                          "yield"),
+                                                                                                        methCall(
+                                                                                                          CLS_Record,
+                                                                                                          SYM(new),
+                                                                                                          (zarray) {2,
+                                                                                                          (zvalue[]) {
+                                                                                                            symbolFromUtf8(
+                                                                                                              5,
+                                                                                                              "maybe"),
+                                                                                                            methCall(
+                                                                                                              CLS_SymbolTable,
+                                                                                                              SYM(new),
+                                                                                                              (zarray) {2,
+                                                                                                              (zvalue[]) {
+                                                                                                                symbolFromUtf8(
+                                                                                                                  5,
+                                                                                                                  "value"),
+                                                                                                                methCall(
+                                                                                                                  CLS_Record,
+                                                                                                                  SYM(new),
+                                                                                                                  (zarray) {2,
+                                                                                                                  (zvalue[]) {
+                                                                                                                    symbolFromUtf8(
+                                                                                                                      4,
+                                                                                                                      "call"),
+                                                                                                                    methCall(
+                                                                                                                      CLS_SymbolTable,
+                                                                                                                      SYM(new),
+                                                                                                                      (zarray) {6,
+                                                                                                                      (zvalue[]) {
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          4,
+                                                                                                                          "name"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_Record,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {2,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            symbolFromUtf8(
+                                                                                                                              7,
+                                                                                                                              "literal"),
+                                                                                                                            methCall(
+                                                                                                                              CLS_SymbolTable,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  5,
+                                                                                                                                  "value"),
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  3,
+                                                                                                                                  "new")}})}}),
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          6,
+                                                                                                                          "target"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_Record,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {2,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            symbolFromUtf8(
+                                                                                                                              5,
+                                                                                                                              "fetch"),
+                                                                                                                            methCall(
+                                                                                                                              CLS_SymbolTable,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  6,
+                                                                                                                                  "target"),
+                                                                                                                                methCall(
+                                                                                                                                  CLS_Record,
+                                                                                                                                  SYM(new),
+                                                                                                                                  (zarray) {2,
+                                                                                                                                  (zvalue[]) {
+                                                                                                                                    symbolFromUtf8(
+                                                                                                                                      6,
+                                                                                                                                      "varRef"),
+                                                                                                                                    methCall(
+                                                                                                                                      CLS_SymbolTable,
+                                                                                                                                      SYM(new),
+                                                                                                                                      (zarray) {2,
+                                                                                                                                      (zvalue[]) {
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          4,
+                                                                                                                                          "name"),
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          4,
+                                                                                                                                          "this")}})}})}})}}),
+                                                                                                                        symbolFromUtf8(
+                                                                                                                          6,
+                                                                                                                          "values"),
+                                                                                                                        methCall(
+                                                                                                                          CLS_List,
+                                                                                                                          SYM(new),
+                                                                                                                          (zarray) {1,
+                                                                                                                          (zvalue[]) {
+                                                                                                                            methCall(
+                                                                                                                              CLS_Record,
+                                                                                                                              SYM(new),
+                                                                                                                              (zarray) {2,
+                                                                                                                              (zvalue[]) {
+                                                                                                                                symbolFromUtf8(
+                                                                                                                                  5,
+                                                                                                                                  "fetch"),
+                                                                                                                                methCall(
+                                                                                                                                  CLS_SymbolTable,
+                                                                                                                                  SYM(new),
+                                                                                                                                  (zarray) {2,
+                                                                                                                                  (zvalue[]) {
+                                                                                                                                    symbolFromUtf8(
+                                                                                                                                      6,
+                                                                                                                                      "target"),
+                                                                                                                                    methCall(
+                                                                                                                                      CLS_Record,
+                                                                                                                                      SYM(new),
+                                                                                                                                      (zarray) {2,
+                                                                                                                                      (zvalue[]) {
+                                                                                                                                        symbolFromUtf8(
+                                                                                                                                          6,
+                                                                                                                                          "varRef"),
+                                                                                                                                        methCall(
+                                                                                                                                          CLS_SymbolTable,
+                                                                                                                                          SYM(new),
+                                                                                                                                          (zarray) {2,
+                                                                                                                                          (zvalue[]) {
+                                                                                                                                            symbolFromUtf8(
+                                                                                                                                              4,
+                                                                                                                                              "name"),
+                                                                                                                                            symbolFromUtf8(
+                                                                                                                                              12,
+                                                                                                                                              "treeOrString")}})}})}})}})}})}})}})}})}})}})}})}})}})}})}})}})}})}}),
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          7,
+                                                                          "closure"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {6,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              7,
+                                                                              "formals"),
+                                                                            EMPTY_LIST,
+                                                                            symbolFromUtf8(
+                                                                              10,
+                                                                              "statements"),
+                                                                            EMPTY_LIST,
+                                                                            symbolFromUtf8(
+                                                                              5,
+                                                                              "yield"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "maybe"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      5,
+                                                                                      "value"),
+                                                                                    methCall(
+                                                                                      CLS_Record,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          5,
+                                                                                          "fetch"),
+                                                                                        methCall(
+                                                                                          CLS_SymbolTable,
+                                                                                          SYM(new),
+                                                                                          (zarray) {2,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              6,
+                                                                                              "target"),
+                                                                                            methCall(
+                                                                                              CLS_Record,
+                                                                                              SYM(new),
+                                                                                              (zarray) {2,
+                                                                                              (zvalue[]) {
+                                                                                                symbolFromUtf8(
+                                                                                                  6,
+                                                                                                  "varRef"),
+                                                                                                methCall(
+                                                                                                  CLS_SymbolTable,
+                                                                                                  SYM(new),
+                                                                                                  (zarray) {2,
+                                                                                                  (zvalue[]) {
+                                                                                                    symbolFromUtf8(
+                                                                                                      4,
+                                                                                                      "name"),
+                                                                                                    symbolFromUtf8(
+                                                                                                      12,
+                                                                                                      "treeOrString")}})}})}})}})}})}})}})}})}})}})}})}})}})}})}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(4, "call"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {6,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(4, "name"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    symbolFromUtf8(3, "new")}})}}),
+                                            symbolFromUtf8(6, "target"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    CLS_SymbolTable}})}}),
+                                            symbolFromUtf8(6, "values"),
+                                            methCall(
+                                              CLS_List,
+                                              SYM(new),
+                                              (zarray) {6,
+                                              (zvalue[]) {
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "flatten")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "closure"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {8,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "formals"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {1,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "this")}})}})}}),
+                                                        symbolFromUtf8(
+                                                          4,
+                                                          "name"),
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "flatten"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "statements"),
+                                                        EMPTY_LIST,
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "yield"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              4,
+                                                              "call"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {6,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "fetch"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "target"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "varRef"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "name"),
+                                                                                symbolFromUtf8(
+                                                                                  6,
+                                                                                  "ACCESS")}})}})}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "target"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "fetch"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "target"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "varRef"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "name"),
+                                                                                symbolFromUtf8(
+                                                                                  4,
+                                                                                  "this")}})}})}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "values"),
+                                                                methCall(
+                                                                  CLS_List,
+                                                                  SYM(new),
+                                                                  (zarray) {1,
+                                                                  (zvalue[]) {
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          7,
+                                                                          "literal"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              5,
+                                                                              "value"),
+                                                                            symbolFromUtf8(
+                                                                              4,
+                                                                              "text")}})}})}})}})}})}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "indent")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "closure"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {8,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "formals"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {3,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "this")}})}}),
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "level")}})}}),
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      10,
+                                                                      "maxColumns")}})}})}}),
+                                                        symbolFromUtf8(
+                                                          4,
+                                                          "name"),
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "indent"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "statements"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {1,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "varDef"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {6,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      3,
+                                                                      "box"),
+                                                                    symbolFromUtf8(
+                                                                      6,
+                                                                      "result"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "text"),
+                                                                    symbolFromUtf8(
+                                                                      5,
+                                                                      "value"),
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          4,
+                                                                          "call"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {6,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              4,
+                                                                              "name"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "fetch"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      6,
+                                                                                      "target"),
+                                                                                    methCall(
+                                                                                      CLS_Record,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          6,
+                                                                                          "varRef"),
+                                                                                        methCall(
+                                                                                          CLS_SymbolTable,
+                                                                                          SYM(new),
+                                                                                          (zarray) {2,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              4,
+                                                                                              "name"),
+                                                                                            symbolFromUtf8(
+                                                                                              6,
+                                                                                              "ACCESS")}})}})}})}}),
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "target"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "fetch"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      6,
+                                                                                      "target"),
+                                                                                    methCall(
+                                                                                      CLS_Record,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          6,
+                                                                                          "varRef"),
+                                                                                        methCall(
+                                                                                          CLS_SymbolTable,
+                                                                                          SYM(new),
+                                                                                          (zarray) {2,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              4,
+                                                                                              "name"),
+                                                                                            symbolFromUtf8(
+                                                                                              4,
+                                                                                              "this")}})}})}})}}),
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "values"),
+                                                                            methCall(
+                                                                              CLS_List,
+                                                                              SYM(new),
+                                                                              (zarray) {1,
+                                                                              (zvalue[]) {
+                                                                                methCall(
+                                                                                  CLS_Record,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      7,
+                                                                                      "literal"),
+                                                                                    methCall(
+                                                                                      CLS_SymbolTable,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          5,
+                                                                                          "value"),
+                                                                                        symbolFromUtf8(
+                                                                                          4,
+                                                                                          "text")}})}})}})}})}})}})}})}}),
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "yield"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              4,
+                                                              "call"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {6,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      7,
+                                                                      "literal"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          5,
+                                                                          "value"),
+                                                                        symbolFromUtf8(
+                                                                          3,
+                                                                          "cat")}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "target"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "call"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {6,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          4,
+                                                                          "name"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              7,
+                                                                              "literal"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "value"),
+                                                                                symbolFromUtf8(
+                                                                                  3,
+                                                                                  "get")}})}}),
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "target"),
+                                                                        methCall(
+                                                                          CLS_Record,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              5,
+                                                                              "fetch"),
+                                                                            methCall(
+                                                                              CLS_SymbolTable,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  6,
+                                                                                  "target"),
+                                                                                methCall(
+                                                                                  CLS_Record,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      6,
+                                                                                      "varRef"),
+                                                                                    methCall(
+                                                                                      CLS_SymbolTable,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          4,
+                                                                                          "name"),
+                                                                                        symbolFromUtf8(
+                                                                                          11,
+                                                                                          "INDENTATION")}})}})}})}}),
+                                                                        symbolFromUtf8(
+                                                                          6,
+                                                                          "values"),
+                                                                        methCall(
+                                                                          CLS_List,
+                                                                          SYM(new),
+                                                                          (zarray) {1,
+                                                                          (zvalue[]) {
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  5,
+                                                                                  "fetch"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      6,
+                                                                                      "target"),
+                                                                                    methCall(
+                                                                                      CLS_Record,
+                                                                                      SYM(new),
+                                                                                      (zarray) {2,
+                                                                                      (zvalue[]) {
+                                                                                        symbolFromUtf8(
+                                                                                          6,
+                                                                                          "varRef"),
+                                                                                        methCall(
+                                                                                          CLS_SymbolTable,
+                                                                                          SYM(new),
+                                                                                          (zarray) {2,
+                                                                                          (zvalue[]) {
+                                                                                            symbolFromUtf8(
+                                                                                              4,
+                                                                                              "name"),
+                                                                                            symbolFromUtf8(
+                                                                                              5,
+                                                                                              "level")}})}})}})}})}})}})}}),
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "values"),
+                                                                methCall(
+                                                                  CLS_List,
+                                                                  SYM(new),
+                                                                  (zarray) {1,
+                                                                  (zvalue[]) {
+                                                                    methCall(
+                                                                      CLS_Record,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          5,
+                                                                          "fetch"),
+                                                                        methCall(
+                                                                          CLS_SymbolTable,
+                                                                          SYM(new),
+                                                                          (zarray) {2,
+                                                                          (zvalue[]) {
+                                                                            symbolFromUtf8(
+                                                                              6,
+                                                                              "target"),
+                                                                            methCall(
+                                                                              CLS_Record,
+                                                                              SYM(new),
+                                                                              (zarray) {2,
+                                                                              (zvalue[]) {
+                                                                                symbolFromUtf8(
+                                                                                  6,
+                                                                                  "varRef"),
+                                                                                methCall(
+                                                                                  CLS_SymbolTable,
+                                                                                  SYM(new),
+                                                                                  (zarray) {2,
+                                                                                  (zvalue[]) {
+                                                                                    symbolFromUtf8(
+                                                                                      4,
+                                                                                      "name"),
+                                                                                    symbolFromUtf8(
+                                                                                      4,
+                                                                                      "text")}})}})}})}})}})}})}})}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          11,
+                                                          "prefersFlat")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "closure"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {8,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          7,
+                                                          "formals"),
+                                                        methCall(
+                                                          CLS_List,
+                                                          SYM(new),
+                                                          (zarray) {1,
+                                                          (zvalue[]) {
+                                                            methCall(
+                                                              CLS_Record,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "formal"),
+                                                                methCall(
+                                                                  CLS_SymbolTable,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "name"),
+                                                                    symbolFromUtf8(
+                                                                      4,
+                                                                      "this")}})}})}}),
+                                                        symbolFromUtf8(
+                                                          4,
+                                                          "name"),
+                                                        symbolFromUtf8(
+                                                          11,
+                                                          "prefersFlat"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "statements"),
+                                                        EMPTY_LIST,
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "yield"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              5,
+                                                              "fetch"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  6,
+                                                                  "target"),
+                                                                methCall(
+                                                                  CLS_Record,
+                                                                  SYM(new),
+                                                                  (zarray) {2,
+                                                                  (zvalue[]) {
+                                                                    symbolFromUtf8(
+                                                                      6,
+                                                                      "varRef"),
+                                                                    methCall(
+                                                                      CLS_SymbolTable,
+                                                                      SYM(new),
+                                                                      (zarray) {2,
+                                                                      (zvalue[]) {
+                                                                        symbolFromUtf8(
+                                                                          4,
+                                                                          "name"),
+                                                                        symbolFromUtf8(
+                                                                          4,
+                                                                          "this")}})}})}})}})}})}})}})}})}})}})}})}})}})}})}}),
+            symbolFromUtf8(5, "yield"),
+            methCall(
+              CLS_Record,
+              SYM(new),
+              (zarray) {2,
+              (zvalue[]) {
+                symbolFromUtf8(4, "call"),
+                methCall(
+                  CLS_SymbolTable,
+                  SYM(new),
+                  (zarray) {6,
+                  (zvalue[]) {
+                    symbolFromUtf8(4, "name"),
+                    methCall(
+                      CLS_Record,
+                      SYM(new),
+                      (zarray) {2,
+                      (zvalue[]) {
+                        symbolFromUtf8(7, "literal"),
+                        methCall(
+                          CLS_SymbolTable,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(5, "value"),
+                            symbolFromUtf8(3, "new")}})}}),
+                    symbolFromUtf8(6, "target"),
+                    methCall(
+                      CLS_Record,
+                      SYM(new),
+                      (zarray) {2,
+                      (zvalue[]) {
+                        symbolFromUtf8(7, "literal"),
+                        methCall(
+                          CLS_SymbolTable,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(5, "value"),
+                            CLS_Record}})}}),
+                    symbolFromUtf8(6, "values"),
+                    methCall(
+                      CLS_List,
+                      SYM(new),
+                      (zarray) {2,
+                      (zvalue[]) {
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(7, "literal"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {2,
+                              (zvalue[]) {
+                                symbolFromUtf8(5, "value"),
+                                symbolFromUtf8(6, "module")}})}}),
+                        methCall(
+                          CLS_Record,
+                          SYM(new),
+                          (zarray) {2,
+                          (zvalue[]) {
+                            symbolFromUtf8(4, "call"),
+                            methCall(
+                              CLS_SymbolTable,
+                              SYM(new),
+                              (zarray) {6,
+                              (zvalue[]) {
+                                symbolFromUtf8(4, "name"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        symbolFromUtf8(3, "new")}})}}),
+                                symbolFromUtf8(6, "target"),
+                                methCall(
+                                  CLS_Record,
+                                  SYM(new),
+                                  (zarray) {2,
+                                  (zvalue[]) {
+                                    symbolFromUtf8(7, "literal"),
+                                    methCall(
+                                      CLS_SymbolTable,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(5, "value"),
+                                        CLS_SymbolTable}})}}),
+                                symbolFromUtf8(6, "values"),
+                                methCall(
+                                  CLS_List,
+                                  SYM(new),
+                                  (zarray) {4,
+                                  (zvalue[]) {
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(7, "literal"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {2,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(5, "value"),
+                                            symbolFromUtf8(7, "exports")}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(4, "call"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {6,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(4, "name"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    symbolFromUtf8(3, "new")}})}}),
+                                            symbolFromUtf8(6, "target"),
+                                            methCall(
+                                              CLS_Record,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "literal"),
+                                                methCall(
+                                                  CLS_SymbolTable,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "value"),
+                                                    CLS_SymbolTable}})}}),
+                                            symbolFromUtf8(6, "values"),
+                                            methCall(
+                                              CLS_List,
+                                              SYM(new),
+                                              (zarray) {2,
+                                              (zvalue[]) {
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      7,
+                                                      "literal"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          5,
+                                                          "value"),
+                                                        symbolFromUtf8(
+                                                          10,
+                                                          "CodeString")}})}}),
+                                                methCall(
+                                                  CLS_Record,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(5, "fetch"),
+                                                    methCall(
+                                                      CLS_SymbolTable,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          6,
+                                                          "target"),
+                                                        methCall(
+                                                          CLS_Record,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              6,
+                                                              "varRef"),
+                                                            methCall(
+                                                              CLS_SymbolTable,
+                                                              SYM(new),
+                                                              (zarray) {2,
+                                                              (zvalue[]) {
+                                                                symbolFromUtf8(
+                                                                  4,
+                                                                  "name"),
+                                                                symbolFromUtf8(
+                                                                  10,
+                                                                  "CodeString")}})}})}})}})}})}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(7, "literal"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {2,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(5, "value"),
+                                            symbolFromUtf8(4, "info")}})}}),
+                                    methCall(
+                                      CLS_Record,
+                                      SYM(new),
+                                      (zarray) {2,
+                                      (zvalue[]) {
+                                        symbolFromUtf8(7, "literal"),
+                                        methCall(
+                                          CLS_SymbolTable,
+                                          SYM(new),
+                                          (zarray) {2,
+                                          (zvalue[]) {
+                                            symbolFromUtf8(5, "value"),
+                                            methCall(
+                                              CLS_SymbolTable,
+                                              SYM(new),
+                                              (zarray) {6,
+                                              (zvalue[]) {
+                                                symbolFromUtf8(7, "exports"),
+                                                methCall(
+                                                  CLS_Map,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    symbolFromUtf8(
+                                                      10,
+                                                      "CodeString"),
+                                                    CLS_Value}}),
+                                                symbolFromUtf8(7, "imports"),
+                                                methCall(
+                                                  CLS_Map,
+                                                  SYM(new),
+                                                  (zarray) {2,
+                                                  (zvalue[]) {
+                                                    methCall(
+                                                      CLS_Record,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          8,
+                                                          "internal"),
+                                                        methCall(
+                                                          CLS_SymbolTable,
+                                                          SYM(new),
+                                                          (zarray) {2,
+                                                          (zvalue[]) {
+                                                            symbolFromUtf8(
+                                                              4,
+                                                              "name"),
+                                                            stringFromUtf8(
+                                                              11,
+                                                              "indentation")}})}}),
+                                                    methCall(
+                                                      CLS_Map,
+                                                      SYM(new),
+                                                      (zarray) {2,
+                                                      (zvalue[]) {
+                                                        symbolFromUtf8(
+                                                          11,
+                                                          "INDENTATION"),
+                                                        CLS_Value}})}}),
+                                                symbolFromUtf8(9, "resources"),
+                                                EMPTY_MAP}})}})}})}})}})}})}})}})}})}})}});
+}
+
+static zvalue lookup(zvalue env, const char *name) {
+    return cm_get(env, symbolFromUtf8(-1, name));
+}
+
+static zvalue externalSource(const char *name) {
+    return cm_new(Record, symbolFromUtf8(-1, "external"),
+        cm_new(SymbolTable,
+            symbolFromUtf8(-1, "name"), stringFromUtf8(-1, name)));
+}
+
+zvalue eval(zvalue env) {
+    zvalue evalFn = lookup(env, "Code_eval");
+
+    if (evalFn == NULL) {
+        zvalue loadModule = lookup(env, "loadModule");
+        if (loadModule == NULL) {
+            die("Binding missing: loadModule or Code_eval");
+        }
+
+        zvalue langModule = FUN_CALL(loadModule, externalSource("core.Code"));
+        evalFn = lookup(langModule, "eval");
+        if (evalFn == NULL) {
+            die("Binding missing: core.Code::eval");
+        }
+    }
+
+    return FUN_CALL(evalFn, env, programTree());
+}
@@ -87,7 +87,7 @@ LINK_BIN_SUFFIX=()
 
 if [[ ${WHAT_OS} == 'linux' ]]; then
     LINK_BIN+=(-rdynamic)
-    LINK_BIN_SUFFIX+=(-ldl)
+    LINK_BIN_SUFFIX+=(-ldl -lpthread)
 fi
 
 # Rules to copy each library source file to the final lib directory.
@@ -540,20 +540,6 @@ METH_IMPL_0_opt(Map, forEach, function) {
     return result;
 }
 
-// Documented in header.
-METH_IMPL_0(Map, gcMark) {
-    MapInfo *info = getInfo(ths);
-    zint size = info->size;
-    zmapping *elems = info->elems;
-
-    for (zint i = 0; i < size; i++) {
-        datMark(elems[i].key);
-        datMark(elems[i].value);
-    }
-
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_1(Map, get, key) {
     MapInfo *info = getInfo(ths);
@@ -642,6 +628,14 @@ METH_IMPL_0(Map, valueList) {
     return listFromZarray((zarray) {size, arr});
 }
 
+/** Gc layout of instances of `Map`. */
+static const zgcLayout theGcLayout = {
+    .elementRefs = 2,
+    .elementSize = sizeof(zmapping),
+    .arrayOffset = offsetof(MapInfo, elems),
+    .countOffset = offsetof(MapInfo, size)
+};
+
 /** Initializes the module. */
 MOD_INIT(Map) {
     MOD_USE(Generator);
@@ -660,7 +654,6 @@ MOD_INIT(Map) {
             METH_BIND(Map, del),
             METH_BIND(Map, fetch),
             METH_BIND(Map, forEach),
-            METH_BIND(Map, gcMark),
             METH_BIND(Map, get),
             METH_BIND(Map, get_key),
             METH_BIND(Map, get_size),
@@ -668,6 +661,7 @@ MOD_INIT(Map) {
             METH_BIND(Map, keyList),
             METH_BIND(Map, nextValue),
             METH_BIND(Map, valueList)));
+    classSetGcLayout(CLS_Map, &theGcLayout);
 
     EMPTY_MAP = datImmortalize(allocMap(0));
 }
@@ -107,14 +107,6 @@ CMETH_IMPL_2_opt_opt(Object, subclass, name, config,
     return makeClass(name, CLS_Object, classMethods, instanceMethods);
 }
 
-// Documented in header.
-METH_IMPL_0(Object, gcMark) {
-    ObjectInfo *info = getInfo(ths);
-
-    datMark(info->data);
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_1(Object, crossEq, other) {
     if (ths == other) {
@@ -143,6 +135,11 @@ METH_IMPL_1(Object, crossOrder, other) {
     return METH_CALL(getInfo(ths)->data, crossOrder, getInfo(other)->data);
 }
 
+/** Gc layout of instances of `Object`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(ObjectInfo, data)
+};
+
 /** Initializes the module. */
 MOD_INIT(Object) {
     MOD_USE(Value);
@@ -154,8 +151,8 @@ MOD_INIT(Object) {
             CMETH_BIND(Object, subclass)),
         METH_TABLE(
             METH_BIND(Object, crossEq),
-            METH_BIND(Object, crossOrder),
-            METH_BIND(Object, gcMark)));
+            METH_BIND(Object, crossOrder)));
+    classSetGcLayout(CLS_Object, &theGcLayout);
 }
 
 // Documented in header.
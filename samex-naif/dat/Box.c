@@ -48,6 +48,25 @@ static zvalue newBox(zvalue cls, BoxInfo info) {
 }
 
 
+//
+// Exported Definitions
+//
+
+// Documented in header.
+zvalue boxFetchDirect(zvalue box) {
+    return getInfo(box)->value;
+}
+
+// Documented in header.
+zvalue cellStoreDirect(zvalue cell, zvalue value) {
+    BoxInfo *info = getInfo(cell);
+
+    datWriteBarrier(cell, info->value, value);
+    info->value = value;
+    return value;
+}
+
+
 //
 // Class Definition: `Box`
 //
@@ -79,14 +98,6 @@ METH_IMPL_0_opt(Box, forEach, function) {
     }
 }
 
-// Documented in spec.
-METH_IMPL_0(Box, gcMark) {
-    BoxInfo *info = getInfo(ths);
-
-    datMark(info->value);
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_1(Box, nextValue, out) {
     zvalue value = METH_CALL(ths, fetch);
@@ -99,6 +110,11 @@ METH_IMPL_1(Box, nextValue, out) {
     }
 }
 
+/** Gc layout of instances of `Box`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(BoxInfo, value)
+};
+
 /** Initializes the module. */
 MOD_INIT(Box) {
     MOD_USE(Core);
@@ -114,8 +130,8 @@ MOD_INIT(Box) {
             METH_BIND(Box, collect),
             METH_BIND(Box, fetch),
             METH_BIND(Box, forEach),
-            METH_BIND(Box, gcMark),
             METH_BIND(Box, nextValue)));
+    classSetGcLayout(CLS_Box, &theGcLayout);
 }
 
 // Documented in header.
@@ -133,8 +149,7 @@ CMETH_IMPL_0_opt(Cell, new, value) {
 
 // Documented in spec.
 METH_IMPL_0_opt(Cell, store, value) {
-    getInfo(ths)->value = value;
-    return value;
+    return cellStoreDirect(ths, value);
 }
 
 /** Initializes the module. */
@@ -168,7 +183,9 @@ METH_IMPL_0(Lazy, fetch) {
     BoxInfo *info = getInfo(ths);
 
     if (info->canStore) {
-        info->value = FUN_CALL(info->value);
+        zvalue value = FUN_CALL(info->value);
+        datWriteBarrier(ths, info->value, value);
+        info->value = value;
         info->canStore = false;
     }
 
@@ -242,6 +259,7 @@ METH_IMPL_0_opt(Promise, store, value) {
         die("Cannot `store()` to resolved `Promise`.");
     }
 
+    datWriteBarrier(ths, info->value, value);
     info->canStore = false;
     info->value = value;
     return value;
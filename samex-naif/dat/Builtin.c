@@ -54,18 +54,19 @@ static BuiltinInfo *getInfo(zvalue builtin) {
 //
 
 // Documented in header.
-zvalue builtinCall(zvalue builtin, zarray args) {
+zvalue builtinCall(zvalue builtin, zvalue first, zarray rest) {
     BuiltinInfo *info = getInfo(builtin);
+    zint argCount = (first == NULL) ? 0 : (rest.size + 1);
 
-    if (args.size < info->minArgs) {
+    if (argCount < info->minArgs) {
         die("Too few arguments for builtin call: %d, min %d",
-            args.size, info->minArgs);
-    } else if (args.size > info->maxArgs) {
+            argCount, info->minArgs);
+    } else if (argCount > info->maxArgs) {
         die("Too many arguments for builtin call: %d, max %d",
-            args.size, info->maxArgs);
+            argCount, info->maxArgs);
     }
 
-    return info->function(builtin, args);
+    return info->function(builtin, first, rest);
 }
 
 
@@ -123,7 +124,10 @@ BuiltinState builtinGetState(zvalue builtin) {
 
 // Documented in spec.
 METH_IMPL_rest(Builtin, call, args) {
-    return builtinCall(ths, args);
+    return (args.size == 0)
+        ? builtinCall(ths, NULL, args)
+        : builtinCall(ths, args.elems[0],
+            (zarray) {args.size - 1, &args.elems[1]});
 }
 
 // Documented in spec.
@@ -132,19 +136,15 @@ METH_IMPL_0(Builtin, debugSymbol) {
     return info->name;
 }
 
-// Documented in header.
-METH_IMPL_0(Builtin, gcMark) {
-    BuiltinInfo *info = getInfo(ths);
-    zvalue *state = info->state;
-
-    datMark(info->name);
-
-    for (zint i = 0; i < info->stateSize; i++) {
-        datMark(state[i]);
-    }
-
-    return NULL;
-}
+/** Gc layout of instances of `Builtin`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(BuiltinInfo, name),
+    .statics = DAT_GC_FIELD(BuiltinInfo, function),
+    .elementRefs = 1,
+    .elementSize = sizeof(zvalue),
+    .arrayOffset = offsetof(BuiltinInfo, state),
+    .countOffset = offsetof(BuiltinInfo, stateSize)
+};
 
 // Documented in header.
 void bindMethodsForBuiltin(void) {
@@ -152,8 +152,8 @@ void bindMethodsForBuiltin(void) {
         NULL,
         METH_TABLE(
             METH_BIND(Builtin, call),
-            METH_BIND(Builtin, debugSymbol),
-            METH_BIND(Builtin, gcMark)));
+            METH_BIND(Builtin, debugSymbol)));
+    classSetGcLayout(CLS_Builtin, &theGcLayout);
 }
 
 /** Initializes the module. */
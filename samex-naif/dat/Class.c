@@ -38,12 +38,86 @@ typedef struct {
     bool isCore;
 
     /**
-     * Bindings from method symbols to functions, keyed off of symbol
-     * index number.
+     * Layout of instances for the purposes of gc marking, if any. When
+     * `NULL`, marking is done by calling the `gcMark()` method.
      */
-    zvalue methods[DAT_MAX_SYMBOLS];
+    const zgcLayout *gcLayout;
+
+    /**
+     * Methods bound directly by this class, as a symbol table from method
+     * symbols to functions. `NULL` if the class binds no methods of its own.
+     * Inherited methods are found by walking the `parent` chain.
+     */
+    zvalue methods;
+
+    /**
+     * Method binding epoch as of when methods were last bound on the class.
+     * See `classMethodEpochOf()`.
+     */
+    zint methodEpoch;
+
+    /**
+     * Number of classes in `ancestors`, that is, the class's depth plus
+     * one.
+     */
+    zint ancestorCount;
+
+    /**
+     * Ancestor display, that is, the class's parent chain indexed by depth.
+     * `ancestors[0]` is `Value`, and the last element is the class itself.
+     * This makes subclass checks a single indexed compare.
+     */
+    zvalue ancestors[];
 } ClassInfo;
 
+enum {
+    /**
+     * Number of ancestors to make room for in the "knotted" classes, which
+     * get made before their parents are known. This is enough for the
+     * deepest of them, `Metaclass`'s metaclass.
+     */
+    KNOT_ANCESTORS = 5
+};
+
+/** Entry in the global method cache. */
+typedef struct {
+    /** Class the lookup was done on. */
+    zvalue cls;
+
+    /** Symbol index of the method. */
+    zint index;
+
+    /** Epoch as of the lookup. Entries from older epochs are invalid. */
+    zint epoch;
+
+    /** Found function. */
+    zvalue function;
+} MethodCacheEntry;
+
+/** The function bound as `Class.accepts()`, once bound. */
+static zvalue theDefaultAccepts = NULL;
+
+/** Global method cache, indexed by a hash of class and symbol index. */
+static MethodCacheEntry theMethodCache[DAT_METHOD_CACHE_SIZE];
+
+/**
+ * Most recently issued method binding epoch. Every class gets a fresh epoch
+ * from this counter when its methods get bound. Starts at `1` so that zeroed
+ * cache entries are all invalid.
+ */
+static zint theMethodEpoch = 1;
+
+/**
+ * Epoch of the most recent binding which could have affected lookups on
+ * classes other than the one being bound, that is, a binding on a class that
+ * might already have subclasses. Since it's later than the epochs of all
+ * classes bound before it, it effectively becomes the epoch of all of them
+ * (see `classMethodEpochOf()`). This only changes during bootstrap and when
+ * loading an image, because classes made via `makeClass()` get their
+ * methods bound before they can have subclasses.
+ */
+static zint theHierarchyEpoch = 1;
+
 
 /**
  * Gets a pointer to the value's info.
@@ -63,20 +137,55 @@ static bool classEqUnchecked(zvalue cls1, zvalue cls2) {
     return (cls1 == cls2);
 }
 
+/**
+ * Returns whether `cls` is `ancestor` or a subclass of it. Does *not* check
+ * to see if the two arguments are actually classes.
+ */
+static bool isSubclassUnchecked(zvalue cls, zvalue ancestor) {
+    ClassInfo *info = getInfo(cls);
+    zint at = getInfo(ancestor)->ancestorCount - 1;
+
+    return (at < info->ancestorCount)
+        && classEqUnchecked(info->ancestors[at], ancestor);
+}
+
 /**
  * Asserts that `value` is an instance of `Class` or a subclass thereof.
  */
 static void assertIsClass(zvalue value) {
-    zvalue cls = classOf(value);
+    if (!isSubclassUnchecked(classOf(value), CLS_Class)) {
+        die("Expected a class; got %s.", cm_debugString(value));
+    }
+}
 
-    while (cls != NULL) {
-        if (classEqUnchecked(cls, CLS_Class)) {
-            return;
-        }
-        cls = getInfo(cls)->parent;
+/**
+ * Sets up the ancestor display of the given class, based on its parent's
+ * display. The class must have been allocated with enough room.
+ */
+static void initAncestors(zvalue cls) {
+    ClassInfo *info = getInfo(cls);
+    zvalue parent = info->parent;
+    zint count = 0;
+
+    if (parent != NULL) {
+        ClassInfo *parentInfo = getInfo(parent);
+        count = parentInfo->ancestorCount;
+        utilCpy(zvalue, info->ancestors, parentInfo->ancestors, count);
     }
 
-    die("Expected a class; got %s.", cm_debugString(value));
+    info->ancestors[count] = cls;
+    info->ancestorCount = count + 1;
+}
+
+/**
+ * Gets the number of bytes of payload to allocate for a class with the
+ * given parent.
+ */
+static zint classPayloadSize(zvalue parent) {
+    zint count =
+        (parent == NULL) ? KNOT_ANCESTORS : getInfo(parent)->ancestorCount + 1;
+
+    return sizeof(ClassInfo) + (count * sizeof(zvalue));
 }
 
 /**
@@ -115,8 +224,9 @@ static zvalue makeClassPair(zvalue name, zvalue parent, bool isCore) {
     // Note: The first time this is ever called, `CLS_Metaclass` is `NULL`.
     // The class in this case is corrected by explicitly setting it after
     // the call to this function.
-    zvalue metacls = datAllocValue(CLS_Metaclass, sizeof(ClassInfo));
-    zvalue cls = datAllocValue(metacls, sizeof(ClassInfo));
+    zvalue metacls = datAllocValue(CLS_Metaclass,
+        classPayloadSize((parent == NULL) ? NULL : parent->cls));
+    zvalue cls = datAllocValue(metacls, classPayloadSize(parent));
     ClassInfo *clsInfo = getInfo(cls);
     ClassInfo *metaInfo = getInfo(metacls);
 
@@ -131,6 +241,8 @@ static zvalue makeClassPair(zvalue name, zvalue parent, bool isCore) {
     if (parent != NULL) {
         clsInfo->parent = parent;
         metaInfo->parent = parent->cls;
+        initAncestors(cls);
+        initAncestors(metacls);
     }
 
     if (isCore) {
@@ -150,20 +262,37 @@ static void initEarlyClass(zvalue cls, zvalue name) {
 }
 
 /**
- * Performs method "reinheritance" on the given class, copying any parent
- * methods that aren't already overridden by the given class. See call site
- * for more info.
+ * Performs gc layout "reinheritance" on the given class, picking up the
+ * parent's layout if the given class doesn't have one. See call site for
+ * more info.
  */
-static void reinheritMethods(zvalue cls) {
+static void reinheritGcLayout(zvalue cls) {
     ClassInfo *info = getInfo(cls);
-    ClassInfo *parentInfo = getInfo(info->parent);
 
-    for (zint i = 0; i < DAT_MAX_SYMBOLS; i++) {
-        zvalue one = parentInfo->methods[i];
-        if ((one != NULL) && (info->methods[i] == NULL)) {
-            info->methods[i] = one;
+    if (info->gcLayout == NULL) {
+        info->gcLayout = getInfo(info->parent)->gcLayout;
+    }
+}
+
+/**
+ * Finds a method by walking up the class's parent chain, without
+ * consulting the method cache. Returns `NULL` if not found.
+ */
+static zvalue findMethodUncached(zvalue cls, zint index) {
+    zvalue name = symbolFromIndex(index);
+
+    for (/*cls*/; cls != NULL; cls = getInfo(cls)->parent) {
+        zvalue methods = getInfo(cls)->methods;
+
+        if (methods != NULL) {
+            zvalue result = symtabGetUnchecked(methods, name);
+            if (result != NULL) {
+                return result;
+            }
         }
     }
+
+    return NULL;
 }
 
 /**
@@ -179,15 +308,21 @@ static bool isCoreClass(ClassInfo *info) {
  * is in fact a class.
  */
 static bool acceptsUnchecked(zvalue cls, zvalue value) {
-    for (zvalue valueCls = classOf(value);
-            valueCls != NULL;
-            valueCls = getInfo(valueCls)->parent) {
-        if (classEqUnchecked(valueCls, cls)) {
-            return true;
-        }
+    return isSubclassUnchecked(classOf(value), cls);
+}
+
+/**
+ * Performs the equivalent of `cls.accepts(value)`, but without doing a
+ * method call when `cls` uses the default `Class.accepts()`.
+ */
+static bool callAccepts(zvalue cls, zvalue value) {
+    zvalue accepts = classFindMethodUnchecked(classOf(cls), SYMIDX(accepts));
+
+    if ((accepts == theDefaultAccepts) && (accepts != NULL)) {
+        return acceptsUnchecked(cls, value);
     }
 
-    return false;
+    return METH_CALL(cls, accepts, value) != NULL;
 }
 
 /**
@@ -196,22 +331,39 @@ static bool acceptsUnchecked(zvalue cls, zvalue value) {
  */
 static void bindOne(zvalue cls, zvalue methods) {
     ClassInfo *info = getInfo(cls);
-    zint size = (methods == NULL) ? 0 : symtabSize(methods);
 
     if (info->parent != NULL) {
-        // Initialize the method table with whatever the parent binds.
-        utilCpy(zvalue, info->methods, getInfo(info->parent)->methods,
-            DAT_MAX_SYMBOLS);
+        info->gcLayout = getInfo(info->parent)->gcLayout;
     }
 
-    if (size != 0) {
-        zmapping arr[size];
-        arrayFromSymtab(arr, methods);
-        for (zint i = 0; i < size; i++) {
-            zint index = symbolIndex(arr[i].key);
-            info->methods[index] = arr[i].value;
-        }
+    if ((methods == NULL) || (symtabSize(methods) == 0)) {
+        info->methods = NULL;
+        return;
     }
+
+    info->methods = methods;
+
+    if (symtabGetUnchecked(methods, SYM(gcMark)) != NULL) {
+        // An explicit `gcMark()` overrides an inherited layout.
+        info->gcLayout = NULL;
+    }
+}
+
+/**
+ * Binds all the methods of a class, and gives it (and its metaclass) a
+ * fresh method binding epoch. This doesn't affect cached lookups on any
+ * other class, so it is only valid to use on a class with no subclasses.
+ */
+static void bindMethods(zvalue cls, zvalue classMethods,
+        zvalue instanceMethods) {
+    datWriteBarrierAll(cls->cls);
+    datWriteBarrierAll(cls);
+    bindOne(cls->cls, classMethods);
+    bindOne(cls, instanceMethods);
+
+    theMethodEpoch++;
+    getInfo(cls)->methodEpoch = theMethodEpoch;
+    getInfo(cls->cls)->methodEpoch = theMethodEpoch;
 }
 
 
@@ -222,22 +374,86 @@ static void bindOne(zvalue cls, zvalue methods) {
 // Documented in header.
 void classBindMethods(zvalue cls, zvalue classMethods,
         zvalue instanceMethods) {
-    bindOne(cls->cls, classMethods);
-    bindOne(cls, instanceMethods);
+    bindMethods(cls, classMethods, instanceMethods);
+
+    // Bootstrap classes can already have subclasses, whose cached lookups
+    // this binding changes, and there's no list of them to go through. So,
+    // all classes get invalidated.
+    theMethodEpoch++;
+    theHierarchyEpoch = theMethodEpoch;
+}
+
+// Documented in header.
+void classAdvanceMethodEpoch(zint epoch) {
+    if (theMethodEpoch <= epoch) {
+        theMethodEpoch = epoch;
+    }
+
+    theMethodEpoch++;
+    theHierarchyEpoch = theMethodEpoch;
 }
 
 // Documented in header.
 zvalue classFindMethodUnchecked(zvalue cls, zint index) {
-    return getInfo(cls)->methods[index];
+    zint hash = (((zint) cls >> 4) ^ (index * 0x9e3779b1))
+        & (DAT_METHOD_CACHE_SIZE - 1);
+    MethodCacheEntry *entry = &theMethodCache[hash];
+
+    zint epoch = classMethodEpochOf(cls);
+
+    if ((entry->cls == cls)
+            && (entry->index == index)
+            && (entry->epoch == epoch)) {
+        return entry->function;
+    }
+
+    zvalue result = findMethodUncached(cls, index);
+
+    if (result != NULL) {
+        *entry = (MethodCacheEntry) {cls, index, epoch, result};
+    }
+
+    return result;
+}
+
+// Documented in header.
+void classFlushMethodCache(void) {
+    utilZero(theMethodCache);
+}
+
+// Documented in header.
+zint classMethodEpoch(void) {
+    return theMethodEpoch;
+}
+
+// Documented in header.
+zint classMethodEpochOf(zvalue cls) {
+    zint epoch = getInfo(cls)->methodEpoch;
+
+    return (epoch > theHierarchyEpoch) ? epoch : theHierarchyEpoch;
+}
+
+// Documented in header.
+const zgcLayout *classGcLayout(zvalue cls) {
+    return getInfo(cls)->gcLayout;
 }
 
 // Documented in header.
 void callGcMark(zvalue value) {
     ClassInfo *info = getInfo(value->cls);
-    zvalue func = info->methods[SYMIDX(gcMark)];
+    const zgcLayout *layout = info->gcLayout;
+
+    if (layout != NULL) {
+        markLayout(value, layout);
+        return;
+    }
+
+    // Note: This can get called on a mark thread, so it mustn't touch the
+    // method cache.
+    zvalue func = findMethodUncached(value->cls, SYMIDX(gcMark));
 
     if (func != NULL) {
-        builtinCall(func, (zarray) {1, &value});
+        builtinCall(func, value, EMPTY_ZARRAY);
     }
 }
 
@@ -252,7 +468,7 @@ extern void assertHasClass(zvalue value, zvalue cls);
 // Documented in header.
 void assertHasClass0(zvalue value, zvalue cls) {
     assertIsClass(cls);
-    if (acceptsUnchecked(cls, value)) {
+    if (!acceptsUnchecked(cls, value)) {
         die("Expected class %s; got %s of class %s.",
             cm_debugString(cls), cm_debugString(value),
             cm_debugString(classOf(value)));
@@ -262,6 +478,12 @@ void assertHasClass0(zvalue value, zvalue cls) {
 // This provides the non-inline version of this function.
 extern zvalue classOf(zvalue value);
 
+// Documented in header.
+void classSetGcLayout(zvalue cls, const zgcLayout *layout) {
+    assertIsClass(cls);
+    getInfo(cls)->gcLayout = layout;
+}
+
 // Documented in header.
 bool haveSameClass(zvalue value, zvalue other) {
     return classEqUnchecked(classOf(value), classOf(other));
@@ -273,7 +495,7 @@ zvalue makeClass(zvalue name, zvalue parent,
     assertIsClass(parent);
 
     zvalue result = makeClassPair(name, parent, false);
-    classBindMethods(result, classMethods, instanceMethods);
+    bindMethods(result, classMethods, instanceMethods);
 
     return result;
 }
@@ -284,26 +506,26 @@ zvalue makeCoreClass(zvalue name, zvalue parent,
     assertIsClass(parent);
 
     zvalue result = makeClassPair(name, parent, true);
-    classBindMethods(result, classMethods, instanceMethods);
+    bindMethods(result, classMethods, instanceMethods);
 
     return result;
 }
 
 // Documented in header.
 zvalue typeAccepts(zvalue cls, zvalue value) {
-    return (METH_CALL(cls, accepts, value) != NULL) ? value : NULL;
+    return callAccepts(cls, value) ? value : NULL;
 }
 
 // Documented in header.
 zvalue typeCast(zvalue cls, zvalue value) {
-    if (METH_CALL(cls, accepts, value) != NULL) {
+    if (callAccepts(cls, value)) {
         return value;
     }
 
     zvalue result = METH_CALL(value, castToward, cls);
 
     if (result != NULL) {
-        if (METH_CALL(cls, accepts, result)) {
+        if (callAccepts(cls, result)) {
             return result;
         }
         value = result;
@@ -311,7 +533,7 @@ zvalue typeCast(zvalue cls, zvalue value) {
 
     result = METH_CALL(cls, castFrom, value);
 
-    if ((result != NULL) && METH_CALL(cls, accepts, result)) {
+    if ((result != NULL) && callAccepts(cls, result)) {
         return result;
     }
 
@@ -400,20 +622,6 @@ METH_IMPL_0(Class, debugSymbol) {
     return getInfo(ths)->name;
 }
 
-// Documented in header.
-METH_IMPL_0(Class, gcMark) {
-    ClassInfo *info = getInfo(ths);
-
-    datMark(info->parent);
-    datMark(info->name);
-
-    for (zint i = 0; i < DAT_MAX_SYMBOLS; i++) {
-        datMark(info->methods[i]);
-    }
-
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_0(Class, get_name) {
     return getInfo(ths)->name;
@@ -472,6 +680,9 @@ MOD_INIT(objectModel) {
             (zint) sizeof(DatHeader));
     }
 
+    // Get death reports to include method calls.
+    initCallTrace();
+
     // Set up the "knotted" classes. These are the ones that have circular
     // is-a and/or heritage relationships with each other. This does *not*
     // include setting up `Symbol`, which is why the `name` of all of these
@@ -500,6 +711,15 @@ MOD_INIT(objectModel) {
     getInfo(CLS_Metaclass)->parent = CLS_Class;
     getInfo(CLS_Metaclass->cls)->parent = CLS_Class->cls;
 
+    // Now that the heritage is known, set up the ancestor displays, each
+    // after that of its parent.
+    initAncestors(CLS_Value);
+    initAncestors(CLS_Class);
+    initAncestors(CLS_Metaclass);
+    initAncestors(CLS_Value->cls);
+    initAncestors(CLS_Class->cls);
+    initAncestors(CLS_Metaclass->cls);
+
     // With the "knotted" classes taken care of, now do the initial
     // special-case setup of `Core` and `Symbol`. These are required for
     // classes to have `name`s.
@@ -526,22 +746,23 @@ MOD_INIT(objectModel) {
     CLS_Builtin     = makeClassPair(SYM(Builtin),     CLS_Core, true);
 
     // At this point, all of the "corest" classes exist but have no bound
-    // methods. Their methods get bound by the following calls. The order of
-    // these calls is significant, since method table setup starts by copying
-    // the parent's class and metaclass tables. Instead of trying to get fancy
-    // with recursive `MOD_USE()` calls (or something like that), we just use
-    // an order here that works.
+    // methods. Their methods get bound by the following calls. Method lookup
+    // walks the parent chain, so the order of these calls doesn't matter as
+    // far as methods go. However, gc layouts are copied from the parent at
+    // binding time, and so the order is significant for them. Instead of
+    // trying to get fancy with recursive `MOD_USE()` calls (or something
+    // like that), we just use an order here that works.
 
     bindMethodsForValue();
     bindMethodsForClass(); // See below.
 
     // These calls are needed because of the circular nature of classes: All
     // of these classes' metaclasses got bound before `Class` itself got its
-    // methods bound, and so we need to "re-percolate" `Class`'s method
-    // bindings down through them.
-    reinheritMethods(CLS_Value->cls);
-    reinheritMethods(CLS_Class->cls);
-    reinheritMethods(CLS_Metaclass->cls);
+    // gc layout set, and so we need to "re-percolate" that layout down
+    // through them.
+    reinheritGcLayout(CLS_Value->cls);
+    reinheritGcLayout(CLS_Class->cls);
+    reinheritGcLayout(CLS_Metaclass->cls);
 
     bindMethodsForCore();
     bindMethodsForSymbol();
@@ -549,6 +770,22 @@ MOD_INIT(objectModel) {
     bindMethodsForBuiltin();
 }
 
+/**
+ * Gc layout of classes, that is, of instances of `Class` and `Metaclass`
+ * (and of all metaclasses).
+ */
+static const zgcLayout theGcLayout = {
+    .fields =
+        DAT_GC_FIELD(ClassInfo, parent) |
+        DAT_GC_FIELD(ClassInfo, name) |
+        DAT_GC_FIELD(ClassInfo, methods),
+    .statics = DAT_GC_FIELD(ClassInfo, gcLayout),
+    .elementRefs = 1,
+    .elementSize = sizeof(zvalue),
+    .arrayOffset = offsetof(ClassInfo, ancestors),
+    .countOffset = offsetof(ClassInfo, ancestorCount)
+};
+
 // Documented in header.
 void bindMethodsForClass(void) {
     classBindMethods(CLS_Class,
@@ -563,11 +800,17 @@ void bindMethodsForClass(void) {
             METH_BIND(Class, crossOrder),
             METH_BIND(Class, debugString),
             METH_BIND(Class, debugSymbol),
-            METH_BIND(Class, gcMark),
             METH_BIND(Class, get_name),
             METH_BIND(Class, get_parent),
             METH_BIND(Class, perOrder)));
 
+    theDefaultAccepts = findMethodUncached(CLS_Class, SYMIDX(accepts));
+
+    // This has to be set before `Metaclass` gets bound, so that the latter
+    // inherits it. All the metaclasses bound before this point pick it up
+    // via `reinheritGcLayout()`.
+    classSetGcLayout(CLS_Class, &theGcLayout);
+
     // `Metaclass` binds no methods itself. TODO: It probably wants at least
     // a couple.
     classBindMethods(CLS_Metaclass,
@@ -48,6 +48,64 @@ static zvalue intFrom(zint value) {
     return result;
 }
 
+/**
+ * List of the methods which take one int (`this`) and are implemented by a
+ * `zint` operation, as `DEF_UNARY(name, function)` entries.
+ */
+#define UNARY_OPS \
+    DEF_UNARY(abs,     zintAbs) \
+    DEF_UNARY(bitSize, zintSafeBitSize) \
+    DEF_UNARY(neg,     zintNeg) \
+    DEF_UNARY(not,     zintNot) \
+    DEF_UNARY(sign,    zintSign)
+
+/**
+ * List of the methods which take two ints (`this` and an argument) and are
+ * implemented by a `zint` operation, as `DEF_BINARY(name, function)` entries.
+ */
+#define BINARY_OPS \
+    DEF_BINARY(add,   zintAdd) \
+    DEF_BINARY(and,   zintAnd) \
+    DEF_BINARY(bit,   zintBit) \
+    DEF_BINARY(div,   zintDiv) \
+    DEF_BINARY(divEu, zintDivEu) \
+    DEF_BINARY(mod,   zintMod) \
+    DEF_BINARY(modEu, zintModEu) \
+    DEF_BINARY(mul,   zintMul) \
+    DEF_BINARY(or,    zintOr) \
+    DEF_BINARY(shl,   zintShl) \
+    DEF_BINARY(shr,   zintShr) \
+    DEF_BINARY(sub,   zintSub) \
+    DEF_BINARY(xor,   zintXor)
+
+/** Unary methods, by the `zint` operation that implements each. */
+static const struct {
+    zvalue *name;
+    bool (*function)(zint *result, zint x);
+} UNARY_TABLE[] = {
+    #define DEF_UNARY(name, function) { &SYM(name), function },
+    UNARY_OPS
+    #undef DEF_UNARY
+};
+
+/** Binary methods, by the `zint` operation that implements each. */
+static const struct {
+    zvalue *name;
+    bool (*function)(zint *result, zint x, zint y);
+} BINARY_TABLE[] = {
+    #define DEF_BINARY(name, function) { &SYM(name), function },
+    BINARY_OPS
+    #undef DEF_BINARY
+};
+
+enum {
+    /** Count of entries in `UNARY_TABLE`. */
+    UNARY_COUNT = sizeof(UNARY_TABLE) / sizeof(UNARY_TABLE[0]),
+
+    /** Count of entries in `BINARY_TABLE`. */
+    BINARY_COUNT = sizeof(BINARY_TABLE) / sizeof(BINARY_TABLE[0])
+};
+
 
 //
 // Exported Definitions
@@ -62,6 +120,34 @@ zvalue intFromZint(zint value) {
     }
 }
 
+// Documented in header.
+zvalue intTryCall(zvalue target, zvalue name, zarray args) {
+    zint x = zintFromInt(target);
+    zint result;
+
+    if (args.size == 0) {
+        for (zint i = 0; i < UNARY_COUNT; i++) {
+            if (*UNARY_TABLE[i].name == name) {
+                return UNARY_TABLE[i].function(&result, x)
+                    ? intFromZint(result)
+                    : NULL;
+            }
+        }
+    } else if ((args.size == 1) && (classOf(args.elems[0]) == CLS_Int)) {
+        zint y = zintValue(args.elems[0]);
+
+        for (zint i = 0; i < BINARY_COUNT; i++) {
+            if (*BINARY_TABLE[i].name == name) {
+                return BINARY_TABLE[i].function(&result, x, y)
+                    ? intFromZint(result)
+                    : NULL;
+            }
+        }
+    }
+
+    return NULL;
+}
+
 // Documented in header.
 zint zintFromInt(zvalue intval) {
     assertHasClass(intval, CLS_Int);
@@ -107,26 +193,14 @@ zint zintFromInt(zvalue intval) {
     extern int semicolonRequiredHere
 
 // All documented in header.
-UNARY_IMPL(abs,     zintAbs);
-UNARY_IMPL(bitSize, zintSafeBitSize);
-UNARY_IMPL(neg,     zintNeg);
-UNARY_IMPL(not,     zintNot);
-UNARY_IMPL(sign,    zintSign);
+#define DEF_UNARY(name, function) UNARY_IMPL(name, function);
+UNARY_OPS
+#undef DEF_UNARY
 
 // All documented in header.
-BINARY_IMPL(add,   zintAdd);
-BINARY_IMPL(and,   zintAnd);
-BINARY_IMPL(bit,   zintBit);
-BINARY_IMPL(div,   zintDiv);
-BINARY_IMPL(divEu, zintDivEu);
-BINARY_IMPL(mod,   zintMod);
-BINARY_IMPL(modEu, zintModEu);
-BINARY_IMPL(mul,   zintMul);
-BINARY_IMPL(or,    zintOr);
-BINARY_IMPL(shl,   zintShl);
-BINARY_IMPL(shr,   zintShr);
-BINARY_IMPL(sub,   zintSub);
-BINARY_IMPL(xor,   zintXor);
+#define DEF_BINARY(name, function) BINARY_IMPL(name, function);
+BINARY_OPS
+#undef DEF_BINARY
 
 // Documented in spec.
 METH_IMPL_1(Int, crossEq, other) {
@@ -353,20 +353,6 @@ METH_IMPL_0_opt(List, forEach, function) {
     return result;
 }
 
-// Documented in header.
-METH_IMPL_0(List, gcMark) {
-    ListInfo *info = getInfo(ths);
-    zarray arr = info->a;
-
-    datMark(info->contentList);
-
-    for (zint i = 0; i < arr.size; i++) {
-        datMark(arr.elems[i]);
-    }
-
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_0(List, get_size) {
     return intFromZint(getInfo(ths)->a.size);
@@ -458,6 +444,17 @@ METH_IMPL_0(List, valueList) {
     return ths;
 }
 
+/** Gc layout of instances of `List`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(ListInfo, contentList),
+    .pointers = DAT_GC_FIELD(ListInfo, a.elems),
+    .elementRefs = 1,
+    .elementSize = sizeof(zvalue),
+    .arrayOffset = offsetof(ListInfo, a.elems),
+    .arrayIndirect = true,
+    .countOffset = offsetof(ListInfo, a.size)
+};
+
 /** Initializes the module. */
 MOD_INIT(List) {
     MOD_USE(Sequence);
@@ -473,7 +470,6 @@ MOD_INIT(List) {
             METH_BIND(List, del),
             METH_BIND(List, fetch),
             METH_BIND(List, forEach),
-            METH_BIND(List, gcMark),
             METH_BIND(List, get_size),
             METH_BIND(List, nextValue),
             METH_BIND(List, nth),
@@ -486,6 +482,7 @@ MOD_INIT(List) {
             SYM(keyList),      FUN_Sequence_keyList,
             SYM(reverseNth),   FUN_Sequence_reverseNth,
             SYM(sliceGeneral), FUN_Sequence_sliceGeneral));
+    classSetGcLayout(CLS_List, &theGcLayout);
 
     EMPTY_LIST = datImmortalize(allocList(0));
 }
@@ -225,15 +225,6 @@ METH_IMPL_rest(Record, del, keys) {
         : cm_new(Record, info->name, newData);
 }
 
-// Documented in header.
-METH_IMPL_0(Record, gcMark) {
-    RecordInfo *info = getInfo(ths);
-
-    datMark(info->name);
-    datMark(info->data);
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_1(Record, get, key) {
     return symtabGetUnchecked(getInfo(ths)->data, key);
@@ -254,6 +245,13 @@ METH_IMPL_1(Record, hasName, name) {
     return symbolEq(getInfo(ths)->name, name) ? ths : NULL;
 }
 
+/** Gc layout of instances of `Record`. */
+static const zgcLayout theGcLayout = {
+    .fields =
+        DAT_GC_FIELD(RecordInfo, name) |
+        DAT_GC_FIELD(RecordInfo, data)
+};
+
 /** Initializes the module. */
 MOD_INIT(Record) {
     MOD_USE(Core);
@@ -268,11 +266,11 @@ MOD_INIT(Record) {
             METH_BIND(Record, crossOrder),
             METH_BIND(Record, debugString),
             METH_BIND(Record, del),
-            METH_BIND(Record, gcMark),
             METH_BIND(Record, get),
             METH_BIND(Record, get_data),
             METH_BIND(Record, get_name),
             METH_BIND(Record, hasName)));
+    classSetGcLayout(CLS_Record, &theGcLayout);
 }
 
 // Documented in header.
@@ -517,14 +517,6 @@ METH_IMPL_0_opt(String, forEach, function) {
     return result;
 }
 
-// Documented in header.
-METH_IMPL_0(String, gcMark) {
-    StringInfo *info = getInfo(ths);
-
-    datMark(info->contentString);
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_0(String, get_size) {
     return intFromZint(getInfo(ths)->s.size);
@@ -631,6 +623,12 @@ METH_IMPL_0(String, valueList) {
     return listFromZarray((zarray) {size, result});
 }
 
+/** Gc layout of instances of `String`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(StringInfo, contentString),
+    .pointers = DAT_GC_FIELD(StringInfo, s.chars)
+};
+
 /** Initializes the module. */
 MOD_INIT(String) {
     MOD_USE(Sequence);
@@ -648,7 +646,6 @@ MOD_INIT(String) {
             METH_BIND(String, del),
             METH_BIND(String, fetch),
             METH_BIND(String, forEach),
-            METH_BIND(String, gcMark),
             METH_BIND(String, get_size),
             METH_BIND(String, nextValue),
             METH_BIND(String, nth),
@@ -661,6 +658,7 @@ MOD_INIT(String) {
             SYM(keyList),      FUN_Sequence_keyList,
             SYM(reverseNth),   FUN_Sequence_reverseNth,
             SYM(sliceGeneral), FUN_Sequence_sliceGeneral));
+    classSetGcLayout(CLS_String, &theGcLayout);
 
     EMPTY_STRING = datImmortalize(allocString(0));
 }
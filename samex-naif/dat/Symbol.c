@@ -3,6 +3,7 @@
 // Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "type/Int.h"
 #include "type/Symbol.h"
@@ -16,21 +17,27 @@
 // Private Definitions
 //
 
-/** Array of all symbols, in index order. */
-static zvalue theSymbols[DAT_MAX_SYMBOLS];
+/** Array of all symbols, in index order. Grown as needed. */
+static zvalue *theSymbols = NULL;
+
+/** Allocated size (in values) of `theSymbols`. */
+static zint theSymbolsCapacity = 0;
 
 /** Next symbol index to assign. */
 static zint theNextIndex = 0;
 
-/** Array of all interned symbols, in sort order (possibly stale). */
-static zvalue theInternedSymbols[DAT_MAX_SYMBOLS];
+/**
+ * Hash table of all interned symbols, keyed by name. Open addressing, with
+ * linear probing.
+ */
+static zvalue *theInternTable = NULL;
+
+/** Size of `theInternTable`. Always a power of two (or `0`). */
+static zint theInternTableSize = 0;
 
 /** The number of interned symbols. */
 static zint theInternedSymbolCount = 0;
 
-/** Whether `theInternedSymbols` needs a sort. */
-static bool theNeedSort = false;
-
 /**
  * Symbol structure.
  */
@@ -41,6 +48,9 @@ typedef struct {
     /** Whether this instance is interned. */
     bool interned;
 
+    /** Hash of the name, per `nameHash()`. */
+    zint hash;
+
     /**
      * Name of the symbol. `chars` points at the actual array built into
      * this object.
@@ -67,15 +77,104 @@ static bool uncheckedEq(zvalue symbol1, zvalue symbol2) {
     return symbol1 == symbol2;
 }
 
+/**
+ * Gets the hash of the given symbol name.
+ */
+static zint nameHash(zstring name) {
+    return utilHash(0, name.chars, name.size * sizeof(zchar));
+}
+
+/**
+ * Finds an existing interned symbol with the given name, if any. `hash`
+ * must be the name's hash, per `nameHash()`.
+ */
+static zvalue findInternedSymbol(zstring name, zint hash) {
+    if (theInternTableSize == 0) {
+        return NULL;
+    }
+
+    zint mask = theInternTableSize - 1;
+
+    for (zint at = hash & mask; /*at*/; at = (at + 1) & mask) {
+        zvalue one = theInternTable[at];
+
+        if (one == NULL) {
+            return NULL;
+        }
+
+        zstring oneName = getInfo(one)->s;
+
+        if ((getInfo(one)->hash == hash)
+                && (oneName.size == name.size)
+                && (memcmp(oneName.chars, name.chars,
+                        name.size * sizeof(zchar)) == 0)) {
+            return one;
+        }
+    }
+}
+
+/**
+ * Adds the given symbol to the intern table, growing the table if it's
+ * getting full. Does not check to see if it's already there.
+ */
+static void internSymbol(zvalue symbol) {
+    if ((theInternedSymbolCount * 2) >= theInternTableSize) {
+        zint oldSize = theInternTableSize;
+        zvalue *oldTable = theInternTable;
+
+        theInternTableSize = (oldSize == 0) ? 1024 : oldSize * 2;
+        theInternTable = utilAlloc(theInternTableSize * sizeof(zvalue));
+        theInternedSymbolCount = 0;
+
+        for (zint i = 0; i < oldSize; i++) {
+            if (oldTable[i] != NULL) {
+                internSymbol(oldTable[i]);
+            }
+        }
+
+        utilFree(oldTable);
+    }
+
+    zint mask = theInternTableSize - 1;
+    zint at = getInfo(symbol)->hash & mask;
+
+    while (theInternTable[at] != NULL) {
+        at = (at + 1) & mask;
+    }
+
+    theInternTable[at] = symbol;
+    theInternedSymbolCount++;
+}
+
+/**
+ * Adds the given symbol to `theSymbols` at the next index, growing the
+ * array if necessary.
+ */
+static void addSymbol(zvalue symbol) {
+    if (theNextIndex == theSymbolsCapacity) {
+        zint newCapacity =
+            (theSymbolsCapacity == 0) ? 1000 : theSymbolsCapacity * 2;
+        zvalue *newSymbols = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (theSymbols != NULL) {
+            utilCpy(zvalue, newSymbols, theSymbols, theNextIndex);
+            utilFree(theSymbols);
+        }
+
+        theSymbols = newSymbols;
+        theSymbolsCapacity = newCapacity;
+    }
+
+    theSymbols[theNextIndex] = symbol;
+    theNextIndex++;
+}
+
 /**
  * Creates and returns a new symbol with the given name. Checks that the
- * size of the name is acceptable and that there aren't already too many
- * symbols. Does no other checking.
+ * size of the name is acceptable. Does no other checking.
  */
 static zvalue makeSymbol0(zstring name, bool interned) {
-    if (theNextIndex >= DAT_MAX_SYMBOLS) {
-        die("Too many symbols!");
-    } else if (name.size > DAT_MAX_SYMBOL_SIZE) {
+    if (name.size > DAT_MAX_SYMBOL_SIZE) {
         die("Symbol name too long: \"%s\"", utf8DupFromZstring(name));
     }
 
@@ -84,17 +183,14 @@ static zvalue makeSymbol0(zstring name, bool interned) {
 
     info->index = theNextIndex;
     info->interned = interned;
+    info->hash = nameHash(name);
     info->s.size = name.size;
     info->s.chars = info->chars;
     utilCpy(zchar, info->chars, name.chars, name.size);
-
-    theSymbols[theNextIndex] = result;
-    theNextIndex++;
+    addSymbol(result);
 
     if (interned) {
-        theInternedSymbols[theInternedSymbolCount] = result;
-        theInternedSymbolCount++;
-        theNeedSort = true;
+        internSymbol(result);
     }
 
     datImmortalize(result);
@@ -118,51 +214,20 @@ static int indexOrder(const void *ptr1, const void *ptr2) {
     return (idx1 < idx2) ? -1 : 1;
 }
 
-/**
- * Compares two symbols for name order. Used for sorting.
- */
-static int sortOrder(const void *vptr1, const void *vptr2) {
-    zvalue v1 = *(zvalue *) vptr1;
-    zvalue v2 = *(zvalue *) vptr2;
-    return zstringOrder(getInfo(v1)->s, getInfo(v2)->s);
-}
-
-/**
- * Compares a name with a symbol. Used for searching.
- */
-static int searchOrder(const void *key, const void *vptr) {
-    const zstring *name = (const zstring *) key;
-    zvalue symbol = *(zvalue *) vptr;
-
-    return zstringOrder(*name, getInfo(symbol)->s);
-}
-
-/**
- * Finds an existing interned symbol with the given name, if any.
- */
-static zvalue findInternedSymbol(zstring name) {
-    if (theNeedSort) {
-        qsort(
-            theInternedSymbols, theInternedSymbolCount,
-            sizeof(zvalue), sortOrder);
-        theNeedSort = false;
-    }
-
-    zvalue *found = (zvalue *) bsearch(
-        &name, theInternedSymbols, theInternedSymbolCount,
-        sizeof(zvalue), searchOrder);
-
-    return (found == NULL) ? NULL : *found;
-}
-
 /**
  * Helper for `symbolFromUtf8` and `unlistedSymbolFromUtf8`, which
  * does all the real work.
  */
 static zvalue anySymbolFromUtf8(zint utfBytes, const char *utf,
         bool interned) {
-    zchar chars[DAT_MAX_SYMBOLS];
-    zstring name = {utf8DecodeStringSize(utfBytes, utf), chars};
+    zint size = utf8DecodeStringSize(utfBytes, utf);
+
+    if (size > DAT_MAX_SYMBOL_SIZE) {
+        die("Symbol name too long: %d characters", size);
+    }
+
+    zchar chars[DAT_MAX_SYMBOL_SIZE];
+    zstring name = {size, chars};
 
     utf8DecodeCharsFromString(chars, utfBytes, utf);
 
@@ -174,6 +239,33 @@ static zvalue anySymbolFromUtf8(zint utfBytes, const char *utf,
 }
 
 
+//
+// Module Definitions
+//
+
+// Documented in header.
+zint symbolCount(void) {
+    return theNextIndex;
+}
+
+// Documented in header.
+void symbolRegister(zvalue symbol) {
+    SymbolInfo *info = getInfo(symbol);
+
+    if (info->index != theNextIndex) {
+        die("Out-of-order symbol registration: %d", info->index);
+    }
+
+    addSymbol(symbol);
+
+    if (info->interned) {
+        internSymbol(symbol);
+    }
+
+    datImmortalize(symbol);
+}
+
+
 //
 // Exported Definitions
 //
@@ -238,7 +330,7 @@ zvalue symbolFromZorder(zorder order) {
 
 // Documented in header.
 zvalue symbolFromZstring(zstring name) {
-    zvalue result = findInternedSymbol(name);
+    zvalue result = findInternedSymbol(name, nameHash(name));
     return (result != NULL) ? result : makeSymbol0(name, true);
 }
 
@@ -372,6 +464,11 @@ METH_IMPL_0(Symbol, toUnlisted) {
     return makeSymbol0(info->s, false);
 }
 
+/** Gc layout of instances of `Symbol`. */
+static const zgcLayout theGcLayout = {
+    .pointers = DAT_GC_FIELD(SymbolInfo, s.chars)
+};
+
 // Documented in header.
 void bindMethodsForSymbol(void) {
     classBindMethods(CLS_Symbol,
@@ -384,6 +481,7 @@ void bindMethodsForSymbol(void) {
             METH_BIND(Symbol, debugSymbol),
             METH_BIND(Symbol, isInterned),
             METH_BIND(Symbol, toUnlisted)));
+    classSetGcLayout(CLS_Symbol, &theGcLayout);
 }
 
 /** Initializes the module. */
@@ -476,19 +476,6 @@ METH_IMPL_rest(SymbolTable, del, keys) {
     return symtabFromZassoc((zassoc) {at, array});
 }
 
-// Documented in header.
-METH_IMPL_0(SymbolTable, gcMark) {
-    SymbolTableInfo *info = getInfo(ths);
-    zint arraySize = info->arraySize;
-
-    for (zint i = 0; i < arraySize; i++) {
-        datMark(info->array[i].key);
-        datMark(info->array[i].value);
-    }
-
-    return NULL;
-}
-
 // Documented in spec.
 METH_IMPL_1(SymbolTable, get, key) {
     return symtabGetUnchecked(ths, key);
@@ -499,6 +486,14 @@ METH_IMPL_0(SymbolTable, get_size) {
     return intFromZint(getInfo(ths)->size);
 }
 
+/** Gc layout of instances of `SymbolTable`. */
+static const zgcLayout theGcLayout = {
+    .elementRefs = 2,
+    .elementSize = sizeof(zmapping),
+    .arrayOffset = offsetof(SymbolTableInfo, array),
+    .countOffset = offsetof(SymbolTableInfo, arraySize)
+};
+
 // Documented in header.
 void bindMethodsForSymbolTable(void) {
     classBindMethods(CLS_SymbolTable,
@@ -510,9 +505,9 @@ void bindMethodsForSymbolTable(void) {
             METH_BIND(SymbolTable, crossEq),
             METH_BIND(SymbolTable, crossOrder),
             METH_BIND(SymbolTable, del),
-            METH_BIND(SymbolTable, gcMark),
             METH_BIND(SymbolTable, get),
             METH_BIND(SymbolTable, get_size)));
+    classSetGcLayout(CLS_SymbolTable, &theGcLayout);
 
     EMPTY_SYMBOL_TABLE = datImmortalize(allocInstance(0));
 }
@@ -14,35 +14,67 @@
 // Private Definitions
 //
 
-/** Array of all immortal values. */
-static zvalue immortals[DAT_MAX_IMMORTALS];
+/** Kinds of gc work. */
+typedef enum {
+    GC_MINOR,   // Stop-the-world nursery collection.
+    GC_FULL,    // Stop-the-world full collection.
+    GC_SLICE,   // One slice of an incremental full collection.
+    GC_FINISH   // Finish off an incremental full collection.
+} zgcKind;
+
+/** Array of all immortal values. Grown as needed. */
+static zvalue *immortals = NULL;
 
 /** How many immortal values there are right now. */
 static zint immortalsSize = 0;
 
-/** List head for the list of all live values. Double-linked circular list. */
-static DatHeader liveHead = {
-    .next = &liveHead,
-    .prev = &liveHead,
-    .mark = MARK_AZURE,
-    .cls = NULL
-};
+/** Allocated size (in values) of `immortals`. */
+static zint immortalsCapacity = 0;
 
 /**
- * List head for the list of all doomed values. Double-linked circular list.
+ * Remembered set, that is, tenured values which may refer to nursery values.
+ * Grown as needed.
  */
-static DatHeader doomedHead = {
-    .next = &doomedHead,
-    .prev = &doomedHead,
-    .mark = MARK_AZURE,
-    .cls = NULL
-};
+static zvalue *remembered = NULL;
+
+/** How many values are in the remembered set. */
+static zint rememberedSize = 0;
+
+/** Allocated size (in values) of `remembered`. */
+static zint rememberedCapacity = 0;
+
+/** Heap growth factor. See `DAT_GC_GROWTH_PERCENT`. */
+static double gcGrowthFactor = DAT_GC_GROWTH_PERCENT / 100.0;
+
+/** Minimum bytes allocated between gcs. See `DAT_GC_MIN_BYTES`. */
+static zint gcMinBytes = DAT_GC_MIN_BYTES;
+
+/** Hard ceiling on the heap size. See `DAT_GC_MAX_BYTES`. */
+static zint gcMaxBytes = DAT_GC_MAX_BYTES;
+
+/** Heap size (in bytes) at which the next gc gets done. */
+static zint nextGcBytes = DAT_GC_MIN_BYTES;
+
+/**
+ * Heap size (in bytes) as of the end of a minor gc, which causes the next
+ * gc to be a full collection instead of a minor one.
+ */
+static zint fullGcBytes = DAT_GC_MIN_BYTES;
+
+/** Whether the next gc should be a full collection. */
+static bool nextGcFull = false;
+
+/** Bytes occupied by tenured (marked) values, as of the end of the last gc. */
+static zint tenuredBytes = 0;
+
+/** Bytes occupied by values born marked during an incremental gc. */
+static zint bornMarkedBytes = 0;
 
-/** Current color that represents live values. */
-static zmarkColor liveColor = MARK_MAUVE;
+/** Whether to do full gcs incrementally. See `DAT_INCREMENTAL_GC`. */
+static bool gcIncremental = DAT_INCREMENTAL_GC;
 
-/** Number of allocations since the last garbage collection. */
-static zint allocationCount = 0;
+/** Whether an incremental gc is in progress (and still marking). */
+static bool gcMarking = false;
 
 /** Number of gcs performed. */
 static zint gcCount = 0;
@@ -50,6 +82,24 @@ static zint gcCount = 0;
 /** Total number live objects. Only used when being chatty. */
 static zint liveCount = 0;
 
+/**
+ * Returns the heap size at which a gc should be triggered, given the size
+ * of the heap which survived a gc.
+ */
+static zint growthLimit(zint liveBytes) {
+    zint result = (zint) (liveBytes * gcGrowthFactor);
+
+    if (result < (liveBytes + gcMinBytes)) {
+        result = liveBytes + gcMinBytes;
+    }
+
+    if ((gcMaxBytes != 0) && (result > gcMaxBytes)) {
+        result = gcMaxBytes;
+    }
+
+    return result;
+}
+
 /**
  * Returns whether the given pointer is properly aligned to be a
  * value.
@@ -62,7 +112,7 @@ static bool isAligned(void *maybeValue) {
 /**
  * Asserts that the value is valid, with thorough (and slow) checking.
  */
-static bool thoroughlyValidate(zvalue maybeValue, zmarkColor expectedColor) {
+static bool thoroughlyValidate(zvalue maybeValue) {
     if (maybeValue == NULL) {
         die("Invalid value: NULL");
     }
@@ -72,21 +122,15 @@ static bool thoroughlyValidate(zvalue maybeValue, zmarkColor expectedColor) {
         return false;
     }
 
-    if (!utilIsHeapAllocated(maybeValue)) {
+    if (!heapIsAllocated(maybeValue)) {
         note("Invalid value (not in heap): %p", maybeValue);
         return false;
     }
 
-    if (maybeValue->mark != expectedColor) {
-        note("Invalid value (wrong color): %p", maybeValue);
-        return false;
-    }
+    zvalue cls = maybeValue->cls;
 
-    if (!(isAligned(maybeValue->next) &&
-          isAligned(maybeValue->prev) &&
-          (maybeValue == maybeValue->next->prev) &&
-          (maybeValue == maybeValue->prev->next))) {
-        note("Invalid value (invalid links): %p", maybeValue);
+    if (!(isAligned(cls) && heapIsAllocated(cls))) {
+        note("Invalid value (invalid class): %p", maybeValue);
         return false;
     }
 
@@ -94,161 +138,377 @@ static bool thoroughlyValidate(zvalue maybeValue, zmarkColor expectedColor) {
 }
 
 /**
- * Sanity check the circular list with the given head.
+ * Helper for `sanityCheck`, which validates a single heap allocation.
  */
-static bool sanityCheckList(DatHeader *head, zmarkColor expectedColor) {
-    for (zvalue item = head->next; item != head; item = item->next) {
-        if (!thoroughlyValidate(item, expectedColor)) {
-            return false;
-        }
+static void sanityCheckOne(void *memory) {
+    if (!thoroughlyValidate(memory)) {
+        die("...in heap.");
     }
+}
 
-    return true;
+/**
+ * Finishes off any sweeping left over from the last gc.
+ */
+static void finishSweep(void) {
+    zint freed = heapSweepFinish();
+
+    if (DAT_CHATTY_GC && (freed != 0)) {
+        liveCount -= freed;
+        note("GC: Swept %d dead values.", freed);
+    }
 }
 
 /**
- * Sanity check the links and tables.
+ * Sanity check the immortals and the heap.
  */
 static void sanityCheck(bool force) {
     if (!(force || DAT_MEMORY_PARANOIA)) {
         return;
     }
 
+    finishSweep();
+
     for (zint i = 0; i < immortalsSize; i++) {
-        if (!thoroughlyValidate(immortals[i], liveColor)) {
+        if (!thoroughlyValidate(immortals[i])) {
             die("...at immortal #%d", i);
         }
     }
 
-    if (!sanityCheckList(&liveHead, liveColor)) {
-        die("...on live list.");
+    heapIterate(sanityCheckOne);
+}
+
+/**
+ * Adds the given (tenured) value to the remembered set.
+ */
+static void remember(zvalue value) {
+    if (rememberedSize == rememberedCapacity) {
+        zint newCapacity =
+            (rememberedCapacity == 0) ? 1000 : rememberedCapacity * 2;
+        zvalue *newRemembered = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (remembered != NULL) {
+            utilCpy(zvalue, newRemembered, remembered, rememberedSize);
+            utilFree(remembered);
+        }
+
+        remembered = newRemembered;
+        rememberedCapacity = newCapacity;
     }
 
-    if (!sanityCheckList(&doomedHead, liveColor ^ 1)) {
-        die("...on doomed list.");
+    value->remembered = true;
+    remembered[rememberedSize] = value;
+    rememberedSize++;
+}
+
+/**
+ * Empties out the remembered set. This must be called before sweeping,
+ * since some of the values in the set may be about to be freed.
+ */
+static void forgetAll(void) {
+    for (zint i = 0; i < rememberedSize; i++) {
+        remembered[i]->remembered = false;
     }
+
+    rememberedSize = 0;
 }
 
 /**
- * Links the given value onto the end of the given list, removing it from its
- * previous list (if any).
+ * Marks the root set, which consists of immortals and the stack, plus (for a
+ * minor gc) the remembered set. This causes anything found to be alive to be
+ * pushed onto the mark deque of this thread. This also empties out the
+ * remembered set.
  */
-static void enlist(DatHeader *head, zvalue value) {
-    if (value->next != NULL) {
-        zvalue next = value->next;
-        zvalue prev = value->prev;
-        next->prev = prev;
-        prev->next = next;
+static void markRoots(bool full) {
+    for (zint i = 0; i < immortalsSize; i++) {
+        datMark(immortals[i]);
+    }
+
+    if (DAT_CHATTY_GC) {
+        note("GC: Marked %d immortals.", immortalsSize);
     }
 
-    zvalue headPrev = head->prev;
+    zint counter = markFrameStack();
 
-    value->prev = headPrev;
-    value->next = head;
-    headPrev->next = value;
-    head->prev = value;
+    if (DAT_CHATTY_GC) {
+        note("GC: Marked %d stack values.", counter);
+    }
+
+    if (!full) {
+        for (zint i = 0; i < rememberedSize; i++) {
+            callGcMark(remembered[i]);
+        }
+
+        if (DAT_CHATTY_GC) {
+            note("GC: Traced %d remembered values.", rememberedSize);
+        }
+    }
+
+    forgetAll();
 }
 
 /**
- * Main garbage collection function.
+ * Finishes a gc once marking is complete, by starting the sweep and then
+ * figuring out when to do the next gc. `markedCount` and `markedBytes` are
+ * the number and total size of the values that got marked.
  */
-static void doGc(void) {
-    zint counter;  // Used throughout.
+static void finishGc(bool full, zint markedCount, zint markedBytes) {
+    if (DAT_CHATTY_GC) {
+        note("GC: Tenured %d values.", markedCount);
+    }
+
+    if (full) {
+        tenuredBytes = markedBytes + bornMarkedBytes;
+        bornMarkedBytes = 0;
+    } else {
+        tenuredBytes += markedBytes;
+    }
+
+    // Values still under construction (which aren't covered by the write
+    // barrier) are all on the frame stack, and any of them that just got
+    // tenured may yet get nursery values stored into them.
+
+    if (DAT_GENERATIONAL_GC) {
+        rememberFrameStack();
+    }
+
+    // Occasional sanity check. This is done before sweeping, so as not to
+    // have to wait for it.
+
+    gcCount++;
+    if (DAT_MEMORY_PARANOIA || ((gcCount & 0x3f) == 0)) {
+        sanityCheck(true);
+    }
+
+    // Free everything that didn't get marked. This happens in the
+    // background.
+
+    heapTrim();
+    trimFrameStack();
+    classFlushMethodCache();
+    heapSweepStart();
 
+    // Figure out when to do the next gc, based on how much survived.
+
+    nextGcBytes = growthLimit(tenuredBytes);
+
+    if (full) {
+        fullGcBytes = nextGcBytes;
+        nextGcFull = false;
+    } else {
+        nextGcFull = (tenuredBytes >= fullGcBytes);
+    }
+
+    if (DAT_CHATTY_GC) {
+        note("GC: %d live heap bytes.", tenuredBytes);
+        note("GC: Next gc at %d heap bytes.", nextGcBytes);
+    }
+}
+
+/**
+ * Main garbage collection function. `full` indicates whether this is a full
+ * collection (as opposed to just a nursery collection).
+ *
+ * Mark bits are "sticky": they stay set after a gc, which is what makes a
+ * surviving value tenured. A minor gc thus never looks inside tenured values
+ * (other than those in the remembered set), and only nursery values can get
+ * swept. A full gc clears all the mark bits first.
+ */
+static void doGc(bool full) {
     if (SYM(gcMark) == NULL) {
         die("`dat` module not yet initialized.");
     }
 
+    finishSweep();
     sanityCheck(false);
 
-    // Quick check: If there have been no allocations, then there's nothing
-    // to do.
-
-    if (liveHead.next == &liveHead) {
-        return;
+    if (full) {
+        heapClearMarks();
     }
 
-    // Start by dooming everything.
+    markRoots(full);
 
-    doomedHead = liveHead;
-    doomedHead.next->prev = &doomedHead;
-    doomedHead.prev->next = &doomedHead;
-    liveHead.next = &liveHead;
-    liveHead.prev = &liveHead;
+    // Calls to `datMark()` just set mark bits and push values onto a mark
+    // deque but do not call through to mark their innards. This traces
+    // through everything pushed (possibly in parallel), which can cause yet
+    // more values to be pushed.
 
-    liveColor = liveColor ^ 1;
+    zint markedBytes;
+    zint markedCount = markTraceAll(&markedBytes);
 
-    // The root set consists of immortals and the stack. Recursively mark
-    // those, which causes anything found to be alive to be linked into
-    // the live list.
+    finishGc(full, markedCount, markedBytes);
+}
 
-    for (zint i = 0; i < immortalsSize; i++) {
-        datMark(immortals[i]);
+/**
+ * Finishes off an incremental gc that is in progress, if any.
+ */
+static void finishGcSlices(void) {
+    if (gcMarking) {
+        zint markedBytes;
+        zint markedCount = markTraceAll(&markedBytes);
+
+        gcMarking = false;
+        finishGc(true, markedCount, markedBytes);
     }
+}
 
-    if (DAT_CHATTY_GC) {
-        note("GC: Marked %d immortals.", immortalsSize);
+/**
+ * Does one slice of an incremental full gc, starting a new one if one isn't
+ * already in progress, and finishing it if there's no more marking to do.
+ *
+ * This is a snapshot-at-the-beginning collector: The roots get marked all at
+ * once when the gc starts, after which the mutator runs between slices. Any
+ * reference that gets overwritten while marking is in progress is marked by
+ * the write barrier, and values allocated while marking is in progress are
+ * born marked. So, everything that was alive at the start ends up marked.
+ */
+static void doGcSlice(void) {
+    if (!gcMarking) {
+        finishSweep();
+        sanityCheck(false);
+        heapClearMarks();
+        markRoots(true);
+        gcMarking = true;
     }
 
-    counter = markFrameStack();
+    if (markTraceSome(DAT_GC_SLICE_VALUES)) {
+        finishGcSlices();
+    } else {
+        nextGcBytes = heapBytesInUse() + DAT_GC_SLICE_BYTES;
+    }
+}
+
+/**
+ * Performs a gc of the given kind, with optional chattiness.
+ */
+static void collect(zgcKind kind) {
+    static const char *KIND_NAMES[] = { "minor", "full", "slice", "finish" };
+    clock_t startTime;
 
     if (DAT_CHATTY_GC) {
-        note("GC: Marked %d stack values.", counter);
+        startTime = clock();
+        note("GC: Cycle #%d (%s).", gcCount, KIND_NAMES[kind]);
     }
 
-    // Calls to `datMark()` just place items on the live list but do not call
-    // through to mark their innards. The following loop walks down the live
-    // list doing that marking, which can cause yet more items to be enlisted.
-    // Since new items are added to the end of the list, there's nothing
-    // special to do to handle such new entries.
+    switch (kind) {
+        case GC_MINOR:  { doGc(false);      break; }
+        case GC_FULL:   { doGc(true);       break; }
+        case GC_SLICE:  { doGcSlice();      break; }
+        case GC_FINISH: { finishGcSlices(); break; }
+    }
 
-    for (zvalue item = liveHead.next; item != &liveHead; item = item->next) {
-        callGcMark(item);
+    if (DAT_CHATTY_GC) {
+        static double totalSec = 0;
+        double elapsedSec = (double) (clock() - startTime) / CLOCKS_PER_SEC;
+        totalSec += elapsedSec;
+        note("GC: %g msec this cycle. %g sec overall.",
+            elapsedSec * 1000, totalSec);
     }
+}
 
-    // Free everything left on the doomed list.
+/**
+ * Returns whether an allocation of the given size would keep the heap under
+ * its hard ceiling (if any).
+ */
+static bool fitsUnderCeiling(zint size) {
+    if (gcMaxBytes == 0) {
+        return true;
+    }
 
-    sanityCheck(false);
+    finishSweep();
+    return (heapBytesInUse() + size) <= gcMaxBytes;
+}
 
-    if (DAT_CHATTY_GC) {
-        counter = 0;
+/**
+ * Does whatever gc is needed to make room for an allocation of the given
+ * size, dying if that would push the heap past its hard ceiling.
+ */
+static void reclaimFor(zint size) {
+    if (SYM(gcMark) == NULL) {
+        // Too early to gc. This can happen with a small enough `gcMinBytes`.
+        return;
     }
 
-    for (zvalue item = doomedHead.next; item != &doomedHead; /*next*/) {
-        if (item->mark == liveColor) {
-            die("Live item on doomed list!");
-        }
+    // If sweeping is still in progress, the heap is smaller than it looks.
 
-        // Need to grab `item->next` before freeing the item.
-        zvalue next = item->next;
+    finishSweep();
+    if ((heapBytesInUse() + size) <= nextGcBytes) {
+        return;
+    }
 
-        // Prevent this from being mistaken for a live value.
-        item->next = item->prev = NULL;
-        item->cls = NULL;
+    bool full = false;
 
-        utilFree(item);
-        item = next;
+    if (gcMarking || (gcIncremental && (!DAT_GENERATIONAL_GC || nextGcFull))) {
+        collect(GC_SLICE);
+    } else if (DAT_GENERATIONAL_GC && !nextGcFull) {
+        collect(GC_MINOR);
+    } else {
+        collect(GC_FULL);
+        full = true;
+    }
 
-        if (DAT_CHATTY_GC) {
-            counter++;
-            liveCount--;
-        }
+    if (fitsUnderCeiling(size)) {
+        return;
     }
 
-    doomedHead.next = &doomedHead;
-    doomedHead.prev = &doomedHead;
+    // Try harder, by finishing any incremental gc in progress, and then
+    // (if that's not enough) doing a stop-the-world full gc.
 
-    if (DAT_CHATTY_GC) {
-        note("GC: Freed %d dead values.", counter);
-        note("GC: %d live values remain.", liveCount);
+    if (gcMarking) {
+        collect(GC_FINISH);
+        if (fitsUnderCeiling(size)) {
+            return;
+        }
     }
 
-    // Occasional sanity check.
+    if (!full) {
+        collect(GC_FULL);
+        if (fitsUnderCeiling(size)) {
+            return;
+        }
+    }
 
-    gcCount++;
-    if (DAT_MEMORY_PARANOIA || ((gcCount & 0x3f) == 0)) {
-        sanityCheck(true);
+    // Lift the limit, so that dying (which allocates) can proceed.
+    zint maxBytes = gcMaxBytes;
+    gcMaxBytes = 0;
+    die("Heap size limit exceeded: %d + %d > %d bytes",
+        heapBytesInUse(), size, maxBytes);
+}
+
+
+//
+// Module Definitions
+//
+
+// Documented in header.
+void allocFinishSweep(void) {
+    finishSweep();
+}
+
+// Documented in header.
+zvalue allocImmortal(zint index) {
+    return immortals[index];
+}
+
+// Documented in header.
+zint allocImmortalCount(void) {
+    return immortalsSize;
+}
+
+// Documented in header.
+zvalue allocValueUnrooted(zvalue cls, zint extraBytes) {
+    zvalue result = heapAlloc(sizeof(DatHeader) + extraBytes);
+    result->cls = cls;
+
+    if (gcMarking) {
+        // Born marked. See `doGcSlice()`.
+        bornMarkedBytes += heapMark(result);
     }
+
+    if (DAT_CHATTY_GC) {
+        liveCount++;
+    }
+
+    return result;
 }
 
 
@@ -264,18 +524,22 @@ zvalue datAllocValue(zvalue cls, zint extraBytes) {
         }
     }
 
-    if (allocationCount >= DAT_ALLOCATIONS_PER_GC) {
-        datGc();
+    zint size = sizeof(DatHeader) + extraBytes;
+
+    if ((heapBytesInUse() + size) > nextGcBytes) {
+        reclaimFor(size);
     } else {
         sanityCheck(false);
     }
 
-    zvalue result = utilAlloc(sizeof(DatHeader) + extraBytes);
-    result->mark  = liveColor;
-    result->cls   = cls;
+    zvalue result = heapAlloc(size);
+    result->cls = cls;
+
+    if (gcMarking) {
+        // Born marked. See `doGcSlice()`.
+        bornMarkedBytes += heapMark(result);
+    }
 
-    allocationCount++;
-    enlist(&liveHead, result);
     datFrameAdd(result);
     sanityCheck(false);
 
@@ -292,8 +556,8 @@ void assertValid(zvalue value) {
         die("Null value.");
     }
 
-    if (value->mark != liveColor) {
-        die("Invalid value (wrong color): %p", value);
+    if (DAT_MEMORY_PARANOIA && !heapIsAllocated(value)) {
+        die("Invalid value (not allocated): %p", value);
     }
 
     if (value->cls == NULL) {
@@ -310,47 +574,94 @@ void assertValidOrNull(zvalue value) {
 
 // Documented in header.
 void datGc(void) {
-    allocationCount = 0;
+    if (gcMarking) {
+        collect(GC_FINISH);
+    }
 
-    if (DAT_CHATTY_GC) {
-        static double totalSec = 0;
-        clock_t startTime = clock();
+    collect(GC_FULL);
+}
 
-        note("GC: Cycle #%d.", gcCount);
-        doGc();
+// Documented in header.
+void datGcConfigure(double growthFactor, zint minBytes, zint maxBytes) {
+    if (growthFactor >= 0) {
+        if (growthFactor < 1) {
+            die("Invalid gc growth factor: %g", growthFactor);
+        }
+        gcGrowthFactor = growthFactor;
+    }
 
-        double elapsedSec = (double) (clock() - startTime) / CLOCKS_PER_SEC;
-        totalSec += elapsedSec;
-        note("GC: %g msec this cycle. %g sec overall.",
-            elapsedSec * 1000, totalSec);
-    } else {
-        doGc();
+    if (minBytes >= 0) {
+        gcMinBytes = minBytes;
     }
+
+    if (maxBytes >= 0) {
+        gcMaxBytes = maxBytes;
+    }
+
+    nextGcBytes = growthLimit(heapBytesInUse());
+    fullGcBytes = nextGcBytes;
 }
 
 // Documented in header.
-zvalue datImmortalize(zvalue value) {
-    if (immortalsSize == DAT_MAX_IMMORTALS) {
-        die("Too many immortal values!");
-    }
+void datGcSetIncremental(bool incremental) {
+    gcIncremental = incremental;
+}
 
+// Documented in header.
+zvalue datImmortalize(zvalue value) {
     assertValid(value);
 
+    if (immortalsSize == immortalsCapacity) {
+        zint newCapacity =
+            (immortalsCapacity == 0) ? 10000 : immortalsCapacity * 2;
+        zvalue *newImmortals = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (immortals != NULL) {
+            utilCpy(zvalue, newImmortals, immortals, immortalsSize);
+            utilFree(immortals);
+        }
+
+        immortals = newImmortals;
+        immortalsCapacity = newCapacity;
+    }
+
     immortals[immortalsSize] = value;
     immortalsSize++;
     return value;
 }
 
 // Documented in header.
-void datMark(zvalue value) {
-    if (value == NULL) {
-        return;
+zvalue datInitStackValue(void *storage, zvalue cls) {
+    zvalue result = storage;
+
+    result->cls = cls;
+    result->remembered = false;
+    return result;
+}
+
+// Documented in header.
+void datWriteBarrier(zvalue target, zvalue oldValue, zvalue newValue) {
+    if (gcMarking) {
+        // Keep everything that was alive at the start of the gc alive, even
+        // if the only reference to it is about to be overwritten.
+        datMark(oldValue);
+    } else if (DAT_GENERATIONAL_GC
+            && (newValue != NULL)
+            && !target->remembered
+            && heapIsMarked(target)
+            && !heapIsMarked(newValue)) {
+        remember(target);
     }
+}
 
-    // Mark the value, and iterate to mark its class (and then metaclass,
-    // etc.). The loop is needed since classes are not all immortal.
-    for (/*value*/; value->mark != liveColor; value = value->cls) {
-        value->mark = liveColor;
-        enlist(&liveHead, value);
+// Documented in header.
+void datWriteBarrierAll(zvalue target) {
+    if (gcMarking) {
+        // As above, but for everything `target` refers to.
+        callGcMark(target);
+    } else if (DAT_GENERATIONAL_GC
+            && !target->remembered
+            && heapIsMarked(target)) {
+        remember(target);
     }
 }
@@ -31,6 +31,50 @@ typedef struct {
     zvalue name;
 } StackTraceEntry;
 
+/**
+ * The call trace. This is a ring of the innermost calls in progress, indexed
+ * by call depth (modulo the ring size). Nothing here gets formatted unless
+ * and until the process dies.
+ */
+static StackTraceEntry theTrace[DAT_CALL_TRACE_SIZE];
+
+/** Number of calls in progress, that is, the depth of `theTrace`. */
+static zint theTraceDepth = 0;
+
+/** Totals of inline method cache activity. */
+static zcallCacheStats theCacheStats;
+
+/**
+ * Starts the stack trace context for a call. This either records the call
+ * in `theTrace` or (if `DAT_FULL_TRACE` is on) links a giblet for it.
+ */
+#define TRACE_START(target, name) \
+    StackTraceEntry ste = {.target = (target), .name = (name)}; \
+    UtilStackGiblet stackGiblet = { \
+        UTIL_GIBLET_MAGIC, utilStackTop, callReporter, &ste \
+    }; \
+    zint traceDepth = theTraceDepth; \
+    do { \
+        if (DAT_FULL_TRACE) { \
+            utilStackTop = &stackGiblet; \
+        } else { \
+            theTrace[traceDepth & (DAT_CALL_TRACE_SIZE - 1)] = ste; \
+            theTraceDepth = traceDepth + 1; \
+        } \
+    } while (0)
+
+/**
+ * Ends the stack trace context for a call, as started by `TRACE_START()`.
+ */
+#define TRACE_END() \
+    do { \
+        if (DAT_FULL_TRACE) { \
+            utilStackTop = stackGiblet.pop; \
+        } else { \
+            theTraceDepth = traceDepth; \
+        } \
+    } while (0)
+
 /**
  * Returns a `dup()`ed string representing `value`. The result is the chars
  * of `value` if it is a string or symbol. Otherwise, it is the result of
@@ -82,6 +126,152 @@ static char *callReporter(void *state) {
     return result;
 }
 
+/**
+ * Like `callReporter()`, for a giblet linked by `methTracePush()`.
+ */
+static char *entryReporter(void *state) {
+    ztraceEntry *entry = state;
+    StackTraceEntry ste = {.target = entry->target, .name = entry->name};
+
+    return callReporter(&ste);
+}
+
+/**
+ * Reports the contents of `theTrace`, innermost call first. This is set up
+ * as the `utilTraceFunction`.
+ */
+static void traceReporter(void (*emit)(const char *line)) {
+    // Only report up to half a ring's worth, because calls made after the
+    // innermost entry was recorded (e.g. to produce the death message) may
+    // have overwritten the entries at the other end. Snapshot what gets
+    // reported, since reporting itself makes calls too.
+    zint depth = theTraceDepth;
+    zint max = DAT_CALL_TRACE_SIZE / 2;
+    zint count = (depth < max) ? depth : max;
+    StackTraceEntry *entries = utilAlloc(count * sizeof(StackTraceEntry));
+
+    for (zint i = 0; i < count; i++) {
+        entries[i] = theTrace[(depth - 1 - i) & (DAT_CALL_TRACE_SIZE - 1)];
+    }
+
+    for (zint i = 0; i < count; i++) {
+        char *line = callReporter(&entries[i]);
+        emit(line);
+        utilFree(line);
+    }
+
+    if (depth > count) {
+        char *line = utilFormat("...%d more", depth - count);
+        emit(line);
+        utilFree(line);
+    }
+
+    utilFree(entries);
+}
+
+/**
+ * Dies with a message about `nameIndex` not being bound as a method on
+ * `cls`.
+ */
+static void dieUnbound(zvalue cls, zint nameIndex) {
+    zvalue nameStr = cm_castFrom(CLS_String, symbolFromIndex(nameIndex));
+    die("Unbound method: %s.%s", cm_debugString(cls),
+        cm_debugString(nameStr));
+}
+
+/**
+ * Finds the function for method `nameIndex` on `cls` via the given inline
+ * cache (of value `owner`), filling in the cache on a miss.
+ */
+static zvalue findCached(zvalue owner, zcallCache *cache, zvalue cls,
+        zint nameIndex) {
+    zmethodCacheEntry *entries = cache->entries;
+    zint size = cache->size;
+    zint epoch = classMethodEpochOf(cls);
+
+    // If `cls` is already in the cache but got rebound since, its entry gets
+    // refilled in place. Otherwise, use the first unused entry. If they're
+    // all in use, replace the last one, so that the earlier (and presumably
+    // more common) classes stay.
+    zint at = -1;
+    zint unused = -1;
+
+    for (zint i = 0; i < size; i++) {
+        zvalue one = entries[i].cls;
+
+        if (one == cls) {
+            if (entries[i].epoch == epoch) {
+                cache->hits++;
+                if (i == 0) {
+                    theCacheStats.monomorphicHits++;
+                } else {
+                    theCacheStats.polymorphicHits++;
+                }
+                return entries[i].function;
+            }
+
+            at = i;
+            break;
+        } else if ((one == NULL) && (unused < 0)) {
+            unused = i;
+        }
+    }
+
+    cache->misses++;
+
+    zvalue function = classFindMethodUnchecked(cls, nameIndex);
+
+    if (function == NULL) {
+        dieUnbound(cls, nameIndex);
+    }
+
+    if (at < 0) {
+        at = (unused >= 0) ? unused : (size - 1);
+    }
+
+    if ((entries[at].cls == NULL) || (entries[at].cls == cls)) {
+        theCacheStats.misses++;
+    } else {
+        theCacheStats.megamorphicMisses++;
+    }
+
+    datWriteBarrier(owner, entries[at].cls, cls);
+    datWriteBarrier(owner, entries[at].function, function);
+    entries[at] = (zmethodCacheEntry) {cls, function, epoch};
+
+    return function;
+}
+
+/**
+ * Calls `function` with `first` as its first argument, followed by `rest`,
+ * that is, `function.call(first, rest*)`. When `function` is a builtin, this
+ * calls it directly, passing `first` separately per the `zfunction` calling
+ * convention, so no argument array needs to get built.
+ */
+static zvalue callFunction(zvalue function, zvalue first, zarray rest) {
+    zvalue cls = classOf(function);
+
+    if (cls == CLS_Builtin) {
+        return builtinCall(function, first, rest);
+    }
+
+    zvalue callFunc = classFindMethodUnchecked(cls, SYMIDX(call));
+
+    if (callFunc == NULL) {
+        dieUnbound(cls, SYMIDX(call));
+    }
+
+    // Prepend `first` to `rest`, to make the arguments to pass to the
+    // function's `call()` method (along with `function` itself as the
+    // first argument).
+    zint newSize = rest.size + 1;
+    zvalue newArgs[newSize];
+    newArgs[0] = first;
+    utilCpy(zvalue, &newArgs[1], rest.elems, rest.size);
+
+    return callFunction(callFunc, function, (zarray) {newSize, newArgs});
+}
+
 /**
  * Helper for `methCall`, which does most of the work but skips argument
  * validation, reference frame, and stack trace setup.
@@ -92,25 +282,32 @@ static zvalue methCall0(zvalue target, zint nameIndex, zarray args) {
     if ((cls == CLS_Builtin) && (nameIndex == SYMIDX(call))) {
         // We are doing an invocation of `Builtin.call()`. Handle this as a
         // special case, in order to break the recursion.
-        return builtinCall(target, args);
+        return (args.size == 0)
+            ? builtinCall(target, NULL, args)
+            : builtinCall(target, args.elems[0],
+                (zarray) {args.size - 1, &args.elems[1]});
     }
 
     zvalue function = classFindMethodUnchecked(cls, nameIndex);
 
     if (function == NULL) {
-        zvalue nameStr = cm_castFrom(CLS_String, symbolFromIndex(nameIndex));
-        die("Unbound method: %s.%s", cm_debugString(cls),
-            cm_debugString(nameStr));
+        dieUnbound(cls, nameIndex);
     }
 
-    // Prepend `target` as a new first argument for a call to `function`.
-    zint newSize = args.size + 1;
-    zvalue newArgs[newSize];
-    newArgs[0] = target;
-    utilCpy(zvalue, &newArgs[1], args.elems, args.size);
-
     // Invoke `function.call(target, args*)`.
-    return methCall0(function, SYMIDX(call), (zarray) {newSize, newArgs});
+    return callFunction(function, target, args);
+}
+
+
+//
+// Module Definitions
+//
+
+// Documented in header.
+void initCallTrace(void) {
+    if (!DAT_FULL_TRACE) {
+        utilTraceFunction = traceReporter;
+    }
 }
 
 
@@ -129,18 +326,122 @@ zvalue methApply(zvalue target, zvalue name, zvalue args) {
 zvalue methCall(zvalue target, zvalue name, zarray args) {
     zint nameIndex = symbolIndex(name);
 
-    StackTraceEntry ste = {.target = target, .name = name};
-    UTIL_TRACE_START(callReporter, &ste);
+    TRACE_START(target, name);
 
     zstackPointer save = datFrameStart();
     zvalue result = methCall0(target, nameIndex, args);
     datFrameReturn(save, result);
 
-    UTIL_TRACE_END();
+    TRACE_END();
+    return result;
+}
+
+// Documented in header.
+zvalue methCallBuiltin(zvalue target, zarray args) {
+    zvalue name = SYM(call);
+
+    TRACE_START(target, name);
+
+    zstackPointer save = datFrameStart();
+    zvalue result = (args.size == 0)
+        ? builtinCall(target, NULL, args)
+        : builtinCall(target, args.elems[0],
+            (zarray) {args.size - 1, &args.elems[1]});
+    datFrameReturn(save, result);
+
+    TRACE_END();
     return result;
 }
 
+// Documented in header.
+zcallCacheStats methCallCacheStats(void) {
+    return theCacheStats;
+}
+
+// Documented in header.
+zvalue methCallCached(zvalue owner, zcallCache *cache, zvalue target,
+        zvalue name, zarray args) {
+    zvalue cls = classOf(target);
+    zint nameIndex = symbolIndex(name);
+
+    if ((cache->size == 0)
+            || ((cls == CLS_Builtin) && (nameIndex == SYMIDX(call)))) {
+        // Either the site doesn't cache, or this is a `Builtin.call()`,
+        // which `methCall0()` handles without a lookup.
+        return methCall(target, name, args);
+    }
+
+    TRACE_START(target, name);
+
+    zstackPointer save = datFrameStart();
+    zvalue function = findCached(owner, cache, cls, nameIndex);
+    zvalue result = callFunction(function, target, args);
+    datFrameReturn(save, result);
+
+    TRACE_END();
+    return result;
+}
+
+// Documented in header.
+ztraceMark methTraceMark(void) {
+    return (ztraceMark) {theTraceDepth, utilStackTop};
+}
+
+// Documented in header.
+void methTracePush(ztraceEntry *entry, zvalue target, zvalue name) {
+    entry->target = target;
+    entry->name = name;
+
+    if (DAT_FULL_TRACE) {
+        entry->giblet = (UtilStackGiblet) {
+            UTIL_GIBLET_MAGIC, utilStackTop, entryReporter, entry
+        };
+        utilStackTop = &entry->giblet;
+    } else {
+        StackTraceEntry ste = {.target = target, .name = name};
+        theTrace[theTraceDepth & (DAT_CALL_TRACE_SIZE - 1)] = ste;
+        theTraceDepth++;
+    }
+}
+
+// Documented in header.
+void methTraceReplace(zvalue target, zvalue name) {
+    StackTraceEntry ste = {.target = target, .name = name};
+
+    if (DAT_FULL_TRACE) {
+        if (utilStackTop == NULL) {
+            // Nothing to replace.
+        } else if (utilStackTop->function == callReporter) {
+            *(StackTraceEntry *) utilStackTop->state = ste;
+        } else if (utilStackTop->function == entryReporter) {
+            ztraceEntry *entry = utilStackTop->state;
+            entry->target = target;
+            entry->name = name;
+        }
+    } else if (theTraceDepth != 0) {
+        theTrace[(theTraceDepth - 1) & (DAT_CALL_TRACE_SIZE - 1)] = ste;
+    }
+}
+
+// Documented in header.
+void methTraceReset(ztraceMark mark) {
+    theTraceDepth = mark.depth;
+    utilStackTop = mark.giblet;
+}
+
 // Documented in header.
 zvalue mustNotYield(zvalue value) {
     die("Improper yield from `noYield` expression.");
 }
+
+// Documented in header.
+zarray zarrayFromArgs(zvalue first, zarray rest, zvalue *elems) {
+    if (first == NULL) {
+        return EMPTY_ZARRAY;
+    }
+
+    elems[0] = first;
+    utilCpy(zvalue, &elems[1], rest.elems, rest.size);
+
+    return (zarray) {rest.size + 1, elems};
+}
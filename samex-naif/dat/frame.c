@@ -2,6 +2,8 @@
 // Licensed AS IS and WITHOUT WARRANTY under the Apache License,
 // Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
 
+#include "util.h"
+
 #include "impl.h"
 
 
@@ -9,17 +11,87 @@
 // Private Definitions
 //
 
-/** Actual stack memory. */
-static zvalue theStack[DAT_MAX_STACK];
+/** Segment of the frame stack. */
+typedef struct FrameSegment {
+    /** Previous (shallower) segment, if any. */
+    struct FrameSegment *prev;
+
+    /** Next (deeper) segment, if any has been made. */
+    struct FrameSegment *next;
+
+    /** Number of references the segment can hold. */
+    zint size;
+
+    /** The references. */
+    zvalue *values;
+} FrameSegment;
+
+/** Reference memory of the first segment. */
+static zvalue theFirstValues[DAT_FRAME_SEGMENT_MIN];
+
+/** The first segment, which is always around. */
+static FrameSegment theFirstSegment = {
+    NULL, NULL, DAT_FRAME_SEGMENT_MIN, theFirstValues
+};
+
+/** The segment that holds the top of the stack. */
+static FrameSegment *theSegment = &theFirstSegment;
+
+/**
+ * Makes the given segment the current one, with the top of the stack at
+ * the given pointer.
+ */
+static void setSegment(FrameSegment *segment, zstackPointer top) {
+    theSegment = segment;
+    frameStackBase = segment->values;
+    frameStackLimit = segment->values + segment->size;
+    frameStackTop = top;
+}
+
+/**
+ * Frees the given segment and all the ones after it.
+ */
+static void freeSegments(FrameSegment *segment) {
+    while (segment != NULL) {
+        FrameSegment *next = segment->next;
+        utilFree(segment);
+        segment = next;
+    }
+}
+
+/**
+ * Calls the given function on all the references on the stack. Returns the
+ * number of references.
+ */
+static zint forEachReference(void (*function)(zvalue)) {
+    zint count = 0;
+
+    for (FrameSegment *s = &theFirstSegment; /*s*/; s = s->next) {
+        // All segments before the current one are full.
+        zint size = (s == theSegment) ? (frameStackTop - s->values) : s->size;
+
+        for (zint i = 0; i < size; i++) {
+            function(s->values[i]);
+        }
+
+        count += size;
+
+        if (s == theSegment) {
+            break;
+        }
+    }
+
+    return count;
+}
 
 // Documented in header.
-zstackPointer frameStackBase = theStack;
+zstackPointer frameStackBase = theFirstValues;
 
 // Documented in header.
-zstackPointer frameStackTop = theStack;
+zstackPointer frameStackTop = theFirstValues;
 
 // Documented in header.
-zstackPointer frameStackLimit = &theStack[DAT_MAX_STACK];
+zstackPointer frameStackLimit = &theFirstValues[DAT_FRAME_SEGMENT_MIN];
 
 // Documented in header.
 void datFrameError(const char *msg) {
@@ -27,24 +99,69 @@ void datFrameError(const char *msg) {
     // the hope that a gc won't end up being done while producing the
     // dying stack trace.
     datGc();
-    frameStackTop = frameStackBase;
+    setSegment(&theFirstSegment, theFirstValues);
 
     die("%s", msg);
 }
 
+// Documented in header.
+void datFrameGrow(void) {
+    FrameSegment *next = theSegment->next;
+
+    if (next == NULL) {
+        zint size = theSegment->size * 2;
+        if (size > DAT_FRAME_SEGMENT_MAX) {
+            size = DAT_FRAME_SEGMENT_MAX;
+        }
+
+        next = utilAlloc(sizeof(FrameSegment) + (size * sizeof(zvalue)));
+        next->prev = theSegment;
+        next->size = size;
+        next->values = (zvalue *) (next + 1);
+        theSegment->next = next;
+    }
+
+    setSegment(next, next->values);
+}
+
+// Documented in header.
+void datFrameUnwind(zstackPointer savedStack) {
+    // Note: `<=` on the limit, because a frame can start right at the
+    // end of a full segment.
+    for (FrameSegment *s = theSegment->prev; s != NULL; s = s->prev) {
+        if ((savedStack >= s->values)
+                && (savedStack <= (s->values + s->size))) {
+            setSegment(s, savedStack);
+            return;
+        }
+    }
+
+    datFrameError("Cannot return to deeper frame.");
+}
+
 
 //
 // Module Definitions
 //
 
+// Documented in header.
 zint markFrameStack(void) {
-    zint stackSize = frameStackTop - frameStackBase;
+    return forEachReference(datMark);
+}
 
-    for (int i = 0; i < stackSize; i++) {
-        datMark(theStack[i]);
-    }
+// Documented in header.
+void rememberFrameStack(void) {
+    forEachReference(datWriteBarrierAll);
+}
 
-    return stackSize;
+// Documented in header.
+void trimFrameStack(void) {
+    FrameSegment *spare = theSegment->next;
+
+    if (spare != NULL) {
+        freeSegments(spare->next);
+        spare->next = NULL;
+    }
 }
 
 
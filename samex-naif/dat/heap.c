@@ -0,0 +1,940 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Value heap: a segregated size-class page allocator
+//
+// Small allocations are carved out of fixed-size, size-aligned pages, each
+// of which serves exactly one size class. Allocations too big for any size
+// class get a dedicated "large" page of their own. Pages that become
+// completely empty go into a pool of spare pages (usable by any size class).
+// Spare pages that go unused for a full gc cycle get handed back to the OS.
+//
+// Each page has two side bitmaps, with one bit per slot: one indicating
+// which slots are allocated, and one holding gc mark bits. A page hands out
+// its lowest-numbered free slot, and sweeping is just a matter of clearing
+// the allocation bits of unmarked slots, without touching the slots
+// themselves.
+//
+// Because pages are aligned to `DAT_HEAP_PAGE_SIZE`, finding the page that
+// holds an allocation is just a mask operation. (Large allocations always
+// start within the first `DAT_HEAP_PAGE_SIZE` bytes of their page.)
+//
+// Sweeping happens in the background, while the program runs. At the end of
+// a gc, every page gets flagged as needing a sweep, and a sweeper thread
+// works through them. Each page is claimed (by the sweeper, or by the
+// allocator if it wants to allocate from the page first) before its bitmaps
+// get touched. The sweeper never touches the allocator's lists; instead it
+// queues up swept pages, and the allocator settles them (making them
+// available for allocation, or retiring them) when it next needs a page.
+//
+
+// Needed for `MAP_ANON` when using glibc.
+#define _DEFAULT_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#include "impl.h"
+
+
+//
+// Private Definitions
+//
+
+enum {
+    /** Mask for clipping addresses to page boundaries. */
+    HEAP_PAGE_MASK = ~((intptr_t) DAT_HEAP_PAGE_SIZE - 1),
+
+    /** Granularity of the smallest size classes. */
+    HEAP_GRANULE = 16,
+
+    /** Maximum number of size classes. */
+    HEAP_MAX_CLASSES = 64,
+
+    /** Size class index used to indicate a large page. */
+    HEAP_LARGE_CLASS = -1,
+
+    /** Size class index used to indicate a spare (unused) page. */
+    HEAP_SPARE_CLASS = -2,
+
+    /** Number of words in each per-page bitmap. */
+    HEAP_BITMAP_WORDS = DAT_HEAP_PAGE_SIZE / HEAP_GRANULE / 64,
+
+    /** Sweep state: page is swept (or never needed it). */
+    SWEEP_DONE = 0,
+
+    /** Sweep state: page needs to be swept. */
+    SWEEP_PENDING,
+
+    /** Sweep state: page is being swept. */
+    SWEEP_BUSY
+};
+
+/**
+ * Per-page metadata. This lives at the very start of each page, and slots
+ * follow it (after alignment padding).
+ */
+typedef struct HeapPage {
+    /** Next page in the size class's list of pages with free slots. */
+    struct HeapPage *next;
+
+    /** Previous page in the size class's list of pages with free slots. */
+    struct HeapPage *prev;
+
+    /** Size class index, or `HEAP_LARGE_CLASS` for a large page. */
+    zint sizeClass;
+
+    /** Total size of the page in bytes, including this header. */
+    zint pageSize;
+
+    /** Size in bytes of each slot. */
+    zint slotSize;
+
+    /**
+     * Reciprocal of `slotSize`, scaled by 2^32 and rounded up. This is used
+     * to turn slot offsets into slot indices without a division.
+     */
+    uint64_t slotReciprocal;
+
+    /** Number of slots in the page. */
+    zint slotCount;
+
+    /**
+     * One more than the highest index of any slot ever handed out. Slots at
+     * or past this index are known to be zeroed, unless the page is `dirty`.
+     */
+    zint bumpCount;
+
+    /** Number of slots currently allocated. */
+    zint liveCount;
+
+    /**
+     * Index of the first bitmap word that might have a free slot. All slots
+     * covered by earlier words are allocated.
+     */
+    zint freeWord;
+
+    /** Whether this page is on its size class's free-slot list. */
+    bool available;
+
+    /** Sweep state. One of the `SWEEP_*` constants. Accessed atomically. */
+    int sweepState;
+
+    /** Next page in the queue of swept pages waiting to be settled. */
+    struct HeapPage *sweptNext;
+
+    /**
+     * Whether never-used slots might contain junk (because the page was
+     * recycled from the spare pool).
+     */
+    bool dirty;
+
+    /** Start of the slot area. */
+    char *slots;
+
+    /** Allocation bitmap, one bit per slot. */
+    uint64_t allocBits[HEAP_BITMAP_WORDS];
+
+    /** Mark bitmap, one bit per slot. */
+    uint64_t markBits[HEAP_BITMAP_WORDS];
+} HeapPage;
+
+/**
+ * Per-size-class state.
+ */
+typedef struct {
+    /** Size in bytes of each slot. */
+    zint slotSize;
+
+    /** Head of the list of pages with at least one free slot. */
+    HeapPage *available;
+} SizeClass;
+
+/** Offset from the start of a page to its first slot. */
+#define HEAP_SLOTS_OFFSET \
+    ((sizeof(HeapPage) + HEAP_GRANULE - 1) & ~(HEAP_GRANULE - 1))
+
+/** All the size classes, in increasing size order. */
+static SizeClass theClasses[HEAP_MAX_CLASSES];
+
+/** Number of size classes. */
+static zint theClassCount = 0;
+
+/** Map from `(size - 1) / HEAP_GRANULE` to size class index. */
+static int8_t theClassForSize[DAT_HEAP_MAX_SMALL / HEAP_GRANULE];
+
+/** All pages (small and large), sorted by address. */
+static HeapPage **thePages = NULL;
+
+/** Number of pages in `thePages`. */
+static zint thePageCount = 0;
+
+/** Allocated size of `thePages`. */
+static zint thePagesCapacity = 0;
+
+/** Pool of spare single-unit pages, linked via `next`. */
+static HeapPage *theSparePages = NULL;
+
+/** Number of pages in `theSparePages`. */
+static zint theSpareCount = 0;
+
+/** Lowest value of `theSpareCount` since the last call to `heapTrim()`. */
+static zint theSpareLowWater = 0;
+
+/**
+ * Number of bytes currently allocated in slots (including slack), not
+ * counting `theSweptBytes`.
+ */
+static zint theBytesInUse = 0;
+
+/**
+ * Pages to be swept, as of the end of the last gc. This is a separate array
+ * from `thePages`, since the latter can change while sweeping is going on.
+ */
+static HeapPage **theSweepList = NULL;
+
+/** Number of pages in `theSweepList`. */
+static zint theSweepCount = 0;
+
+/** Allocated size of `theSweepList`. */
+static zint theSweepCapacity = 0;
+
+/** Index of the next page in `theSweepList` to claim. Accessed atomically. */
+static zint theSweepCursor = 0;
+
+/** Whether sweeping is in progress (that is, not yet finished off). */
+static bool theSweepActive = false;
+
+/** Bytes freed by sweeping, not yet subtracted from `theBytesInUse`. */
+static zint theSweptBytes = 0;
+
+/** Number of allocations freed by sweeping since the last gc. */
+static zint theSweptCount = 0;
+
+/** Whether the sweeper thread has been started. */
+static bool theSweeperStarted = false;
+
+/** Lock for the swept page queue and the sweeper thread coordination. */
+static pthread_mutex_t theSweepLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Condition signaled when there is a new round of sweeping to do. */
+static pthread_cond_t theSweepWake = PTHREAD_COND_INITIALIZER;
+
+/** Condition signaled when the sweeper thread is done with a round. */
+static pthread_cond_t theSweepDone = PTHREAD_COND_INITIALIZER;
+
+/** Sweep round number, incremented at the end of each gc. */
+static zint theSweepRound = 0;
+
+/** Last sweep round that the sweeper thread finished. */
+static zint theSweeperRound = 0;
+
+/** Queue of swept pages waiting to be settled, linked via `sweptNext`. */
+static HeapPage *theSweptPages = NULL;
+
+/**
+ * Sets up the size class tables. Sizes go up by `HEAP_GRANULE` to start
+ * with, and then by about a quarter of the previous size.
+ */
+static void initClasses(void) {
+    zint size = HEAP_GRANULE;
+
+    while (size <= DAT_HEAP_MAX_SMALL) {
+        if (theClassCount == HEAP_MAX_CLASSES) {
+            die("Too many heap size classes.");
+        }
+
+        theClasses[theClassCount].slotSize = size;
+        theClassCount++;
+
+        zint step = size / 4;
+        if (step < HEAP_GRANULE) {
+            step = HEAP_GRANULE;
+        }
+        size = (size + step + HEAP_GRANULE - 1) & ~(HEAP_GRANULE - 1);
+    }
+
+    // Make sure the last class covers the full small range.
+    theClasses[theClassCount - 1].slotSize = DAT_HEAP_MAX_SMALL;
+
+    zint cls = 0;
+    for (zint i = 0; i < DAT_HEAP_MAX_SMALL / HEAP_GRANULE; i++) {
+        zint size = (i + 1) * HEAP_GRANULE;
+        while (theClasses[cls].slotSize < size) {
+            cls++;
+        }
+        theClassForSize[i] = cls;
+    }
+}
+
+/**
+ * Maps fresh zeroed memory of the given size (a multiple of the page size),
+ * aligned to `DAT_HEAP_PAGE_SIZE`.
+ */
+static void *mapAligned(zint size) {
+    zint mapSize = size + DAT_HEAP_PAGE_SIZE;
+    char *raw = mmap(NULL, mapSize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANON, -1, 0);
+
+    if (raw == MAP_FAILED) {
+        die("Failed to allocate heap page: size %x", size);
+    }
+
+    char *start = (char *) (((intptr_t) raw + DAT_HEAP_PAGE_SIZE - 1)
+        & HEAP_PAGE_MASK);
+    char *end = start + size;
+    char *rawEnd = raw + mapSize;
+
+    if (start != raw) {
+        munmap(raw, start - raw);
+    }
+
+    if (end != rawEnd) {
+        munmap(end, rawEnd - end);
+    }
+
+    return start;
+}
+
+/**
+ * Finds the index in `thePages` of the page with the highest address that is
+ * at or below the given address, or `-1` if there is no such page.
+ */
+static zint findPageIndex(intptr_t address) {
+    zint min = 0;
+    zint max = thePageCount - 1;
+    zint found = -1;
+
+    while (min <= max) {
+        zint guess = (min + max) / 2;
+
+        if ((intptr_t) thePages[guess] <= address) {
+            found = guess;
+            min = guess + 1;
+        } else {
+            max = guess - 1;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Adds a page to the page registry.
+ */
+static void registerPage(HeapPage *page) {
+    if (thePageCount == thePagesCapacity) {
+        zint newCapacity = (thePagesCapacity == 0) ? 64 : thePagesCapacity * 2;
+        HeapPage **newPages = utilAlloc(newCapacity * sizeof(HeapPage *));
+
+        if (thePages != NULL) {
+            utilCpy(HeapPage *, newPages, thePages, thePageCount);
+            utilFree(thePages);
+        }
+
+        thePages = newPages;
+        thePagesCapacity = newCapacity;
+    }
+
+    zint at = findPageIndex((intptr_t) page) + 1;
+    memmove(&thePages[at + 1], &thePages[at],
+        (thePageCount - at) * sizeof(HeapPage *));
+    thePages[at] = page;
+    thePageCount++;
+}
+
+/**
+ * Removes a page from the page registry, and hands its memory back to the OS.
+ */
+static void releasePage(HeapPage *page) {
+    zint at = findPageIndex((intptr_t) page);
+
+    if ((at < 0) || (thePages[at] != page)) {
+        die("Releasing unregistered heap page: %p", page);
+    }
+
+    thePageCount--;
+    memmove(&thePages[at], &thePages[at + 1],
+        (thePageCount - at) * sizeof(HeapPage *));
+
+    munmap(page, page->pageSize);
+}
+
+/**
+ * Links a page onto the head of its size class's list of available pages.
+ */
+static void linkAvailable(SizeClass *sc, HeapPage *page) {
+    page->prev = NULL;
+    page->next = sc->available;
+
+    if (sc->available != NULL) {
+        sc->available->prev = page;
+    }
+
+    sc->available = page;
+    page->available = true;
+}
+
+/**
+ * Unlinks a page from its size class's list of available pages.
+ */
+static void unlinkAvailable(SizeClass *sc, HeapPage *page) {
+    if (page->prev != NULL) {
+        page->prev->next = page->next;
+    } else {
+        sc->available = page->next;
+    }
+
+    if (page->next != NULL) {
+        page->next->prev = page->prev;
+    }
+
+    page->next = page->prev = NULL;
+    page->available = false;
+}
+
+/**
+ * Gets a page of the given size (a multiple of `DAT_HEAP_PAGE_SIZE`), either
+ * recycling a spare page or mapping a new one. The result is registered,
+ * but its header is otherwise uninitialized.
+ */
+static HeapPage *obtainPage(zint pageSize) {
+    HeapPage *page;
+
+    if ((pageSize == DAT_HEAP_PAGE_SIZE) && (theSparePages != NULL)) {
+        page = theSparePages;
+        theSparePages = page->next;
+        theSpareCount--;
+
+        if (theSpareCount < theSpareLowWater) {
+            theSpareLowWater = theSpareCount;
+        }
+
+        memset(page, 0, HEAP_SLOTS_OFFSET);
+        page->dirty = true;
+    } else {
+        page = mapAligned(pageSize);
+        registerPage(page);
+    }
+
+    page->pageSize = pageSize;
+    page->slots = (char *) page + HEAP_SLOTS_OFFSET;
+    return page;
+}
+
+/**
+ * Retires a page which no longer has any allocations in it, either keeping
+ * it in the spare pool or handing it back to the OS.
+ */
+static void retirePage(HeapPage *page) {
+    if (page->pageSize == DAT_HEAP_PAGE_SIZE) {
+        page->sizeClass = HEAP_SPARE_CLASS;
+        page->next = theSparePages;
+        theSparePages = page;
+        theSpareCount++;
+    } else {
+        releasePage(page);
+    }
+}
+
+/**
+ * Makes a new page for the given size class.
+ */
+static HeapPage *newSmallPage(zint sizeClass) {
+    HeapPage *page = obtainPage(DAT_HEAP_PAGE_SIZE);
+    zint slotSize = theClasses[sizeClass].slotSize;
+
+    page->sizeClass = sizeClass;
+    page->slotSize = slotSize;
+    page->slotReciprocal = ((1ULL << 32) + slotSize - 1) / slotSize;
+    page->slotCount = (DAT_HEAP_PAGE_SIZE - HEAP_SLOTS_OFFSET) / slotSize;
+
+    return page;
+}
+
+/**
+ * Allocates a large object, on a page of its own.
+ */
+static void *allocLarge(zint size) {
+    zint pageSize = (HEAP_SLOTS_OFFSET + size + DAT_HEAP_PAGE_SIZE - 1)
+        & HEAP_PAGE_MASK;
+    HeapPage *page = obtainPage(pageSize);
+
+    page->sizeClass = HEAP_LARGE_CLASS;
+    page->slotSize = pageSize - HEAP_SLOTS_OFFSET;
+    page->slotCount = 1;
+    page->bumpCount = 1;
+    page->liveCount = 1;
+    page->allocBits[0] = 1;
+
+    if (page->dirty) {
+        memset(page->slots, 0, size);
+    }
+
+    theBytesInUse += page->slotSize;
+    return page->slots;
+}
+
+/**
+ * Gets the page that the given heap pointer points into. Does no checking.
+ */
+static HeapPage *pageOf(void *memory) {
+    return (HeapPage *) ((intptr_t) memory & HEAP_PAGE_MASK);
+}
+
+/**
+ * Gets the slot index of the given allocation within the given page. Does no
+ * checking. The multiply-and-shift is exact because slot offsets are always
+ * exact multiples of the slot size and much less than 2^32.
+ */
+static zint slotIndex(HeapPage *page, void *memory) {
+    uint64_t offset = (char *) memory - page->slots;
+    return (zint) ((offset * page->slotReciprocal) >> 32);
+}
+
+/**
+ * Sweeps the bitmaps of a single page, which the caller must have claimed,
+ * freeing all allocated but unmarked slots. This doesn't touch any of the
+ * allocator's shared structures; see `settlePage()`. Returns the number of
+ * slots freed.
+ */
+static zint sweepPage(HeapPage *page) {
+    if (page->sizeClass == HEAP_LARGE_CLASS) {
+        if (page->markBits[0] & 1) {
+            return 0;
+        }
+
+        page->allocBits[0] = 0;
+        page->liveCount = 0;
+        __atomic_add_fetch(&theSweptBytes, page->slotSize, __ATOMIC_RELAXED);
+        return 1;
+    }
+
+    zint words = (page->slotCount + 63) / 64;
+    zint freed = 0;
+
+    for (zint i = 0; i < words; i++) {
+        uint64_t dead = page->allocBits[i] & ~page->markBits[i];
+
+        if (dead != 0) {
+            page->allocBits[i] ^= dead;
+            freed += __builtin_popcountll(dead);
+
+            if (i < page->freeWord) {
+                page->freeWord = i;
+            }
+        }
+    }
+
+    if (freed != 0) {
+        page->liveCount -= freed;
+        __atomic_add_fetch(&theSweptBytes, freed * page->slotSize,
+            __ATOMIC_RELAXED);
+    }
+
+    return freed;
+}
+
+/**
+ * Claims and sweeps pages from `theSweepList` until there are none left to
+ * claim. Swept pages that need settling get queued up. This is called both
+ * from the sweeper thread and from the allocator's thread.
+ */
+static void sweepClaimed(void) {
+    for (;;) {
+        zint at = __atomic_fetch_add(&theSweepCursor, 1, __ATOMIC_RELAXED);
+
+        if (at >= theSweepCount) {
+            break;
+        }
+
+        HeapPage *page = theSweepList[at];
+        int expected = SWEEP_PENDING;
+
+        if (!__atomic_compare_exchange_n(&page->sweepState, &expected,
+                SWEEP_BUSY, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            // The allocator already got to it.
+            continue;
+        }
+
+        zint freed = sweepPage(page);
+
+        if (freed != 0) {
+            __atomic_add_fetch(&theSweptCount, freed, __ATOMIC_RELAXED);
+            pthread_mutex_lock(&theSweepLock);
+            page->sweptNext = theSweptPages;
+            theSweptPages = page;
+            pthread_mutex_unlock(&theSweepLock);
+        }
+
+        __atomic_store_n(&page->sweepState, SWEEP_DONE, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * Makes sure that the given page is swept, sweeping it on this thread if
+ * it is still pending, or waiting for the sweeper thread if it is in the
+ * middle of sweeping it.
+ */
+static void ensureSwept(HeapPage *page) {
+    if (__atomic_load_n(&page->sweepState, __ATOMIC_ACQUIRE) == SWEEP_DONE) {
+        return;
+    }
+
+    int expected = SWEEP_PENDING;
+
+    if (__atomic_compare_exchange_n(&page->sweepState, &expected,
+            SWEEP_BUSY, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        __atomic_add_fetch(&theSweptCount, sweepPage(page), __ATOMIC_RELAXED);
+        __atomic_store_n(&page->sweepState, SWEEP_DONE, __ATOMIC_RELAXED);
+        return;
+    }
+
+    while (__atomic_load_n(&page->sweepState, __ATOMIC_ACQUIRE) != SWEEP_DONE) {
+        sched_yield();
+    }
+}
+
+/**
+ * Updates the allocator's structures to account for a page that got swept,
+ * either retiring it (if it is now empty) or making it available for
+ * allocation.
+ */
+static void settlePage(HeapPage *page) {
+    if (page->sizeClass == HEAP_LARGE_CLASS) {
+        if (page->liveCount == 0) {
+            retirePage(page);
+        }
+        return;
+    }
+
+    SizeClass *sc = &theClasses[page->sizeClass];
+
+    if (page->liveCount == 0) {
+        if (page->available) {
+            unlinkAvailable(sc, page);
+        }
+        retirePage(page);
+    } else if (!page->available && (page->liveCount < page->slotCount)) {
+        linkAvailable(sc, page);
+    }
+}
+
+/**
+ * Settles all the pages in the swept page queue, and accounts for the bytes
+ * freed by sweeping.
+ */
+static void settleSwept(void) {
+    pthread_mutex_lock(&theSweepLock);
+    HeapPage *page = theSweptPages;
+    theSweptPages = NULL;
+    pthread_mutex_unlock(&theSweepLock);
+
+    while (page != NULL) {
+        HeapPage *next = page->sweptNext;
+        page->sweptNext = NULL;
+        settlePage(page);
+        page = next;
+    }
+
+    theBytesInUse -= __atomic_exchange_n(&theSweptBytes, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * Main function of the sweeper thread.
+ */
+static void *sweeperMain(void *arg) {
+    pthread_mutex_lock(&theSweepLock);
+
+    for (;;) {
+        while (theSweeperRound == theSweepRound) {
+            pthread_cond_wait(&theSweepWake, &theSweepLock);
+        }
+
+        zint round = theSweepRound;
+        pthread_mutex_unlock(&theSweepLock);
+
+        sweepClaimed();
+
+        pthread_mutex_lock(&theSweepLock);
+        theSweeperRound = round;
+        pthread_cond_signal(&theSweepDone);
+    }
+
+    return NULL;
+}
+
+//
+// Module Definitions
+//
+
+// Documented in header.
+void *heapAlloc(zint size) {
+    if (size <= 0) {
+        die("Invalid allocation size: %d", size);
+    } else if (size > DAT_HEAP_MAX_SMALL) {
+        return allocLarge(size);
+    }
+
+    if (theClassCount == 0) {
+        initClasses();
+    }
+
+    zint sizeClass = theClassForSize[(size - 1) / HEAP_GRANULE];
+    SizeClass *sc = &theClasses[sizeClass];
+    HeapPage *page = sc->available;
+
+    if (page == NULL) {
+        // Before making a new page, see if sweeping has freed up space.
+        settleSwept();
+        page = sc->available;
+
+        if (page == NULL) {
+            page = newSmallPage(sizeClass);
+            linkAvailable(sc, page);
+        }
+    }
+
+    if (theSweepActive) {
+        ensureSwept(page);
+    }
+
+    // Find the lowest free slot. Because the page is on the available list,
+    // there is guaranteed to be one, and it is guaranteed to be in range.
+
+    zint word = page->freeWord;
+    while (page->allocBits[word] == ~(uint64_t) 0) {
+        word++;
+    }
+
+    uint64_t bits = page->allocBits[word];
+    zint index = (word * 64) + __builtin_ctzll(~bits);
+    void *result = page->slots + (index * page->slotSize);
+
+    page->allocBits[word] = bits | (bits + 1);  // Sets the lowest zero bit.
+    page->freeWord = word;
+
+    if (index >= page->bumpCount) {
+        // Never-used memory. This is already zeroed unless the page got
+        // recycled.
+        page->bumpCount = index + 1;
+        if (page->dirty) {
+            memset(result, 0, page->slotSize);
+        }
+    } else {
+        // Reuse of a freed slot. It needs to be zeroed, since it could have
+        // any old junk in it.
+        memset(result, 0, page->slotSize);
+    }
+
+    page->liveCount++;
+    theBytesInUse += page->slotSize;
+
+    if (page->liveCount == page->slotCount) {
+        unlinkAvailable(sc, page);
+    }
+
+    return result;
+}
+
+// Documented in header.
+zint heapBytesInUse(void) {
+    return theBytesInUse;
+}
+
+// Documented in header.
+void heapClearMarks(void) {
+    for (zint i = 0; i < thePageCount; i++) {
+        HeapPage *page = thePages[i];
+
+        if (page->sizeClass != HEAP_SPARE_CLASS) {
+            memset(page->markBits, 0, sizeof(page->markBits));
+        }
+    }
+}
+
+// Documented in header.
+void *heapFind(void *memory, zint *size) {
+    intptr_t address = (intptr_t) memory;
+    zint at = findPageIndex(address);
+
+    if (at < 0) {
+        return NULL;
+    }
+
+    HeapPage *page = thePages[at];
+    intptr_t slotsStart = (intptr_t) page->slots;
+    intptr_t slotsEnd = slotsStart + (page->slotCount * page->slotSize);
+
+    if ((page->sizeClass == HEAP_SPARE_CLASS)
+            || (address < slotsStart)
+            || (address >= slotsEnd)) {
+        return NULL;
+    }
+
+    zint index = (address - slotsStart) / page->slotSize;
+
+    if (!((page->allocBits[index / 64] >> (index % 64)) & 1)) {
+        return NULL;
+    }
+
+    if (size != NULL) {
+        *size = page->slotSize;
+    }
+
+    return page->slots + (index * page->slotSize);
+}
+
+// Documented in header.
+bool heapIsAllocated(void *memory) {
+    intptr_t address = (intptr_t) memory;
+    zint at = findPageIndex(address);
+
+    if (at < 0) {
+        return false;
+    }
+
+    HeapPage *page = thePages[at];
+    intptr_t slotsStart = (intptr_t) page->slots;
+    intptr_t slotsEnd = slotsStart + (page->slotCount * page->slotSize);
+
+    if ((page->sizeClass == HEAP_SPARE_CLASS)
+            || (address < slotsStart)
+            || (address >= slotsEnd)
+            || (((address - slotsStart) % page->slotSize) != 0)) {
+        return false;
+    }
+
+    zint index = slotIndex(page, memory);
+    return (page->allocBits[index / 64] >> (index % 64)) & 1;
+}
+
+// Documented in header.
+bool heapIsMarked(void *memory) {
+    HeapPage *page = pageOf(memory);
+    zint index = slotIndex(page, memory);
+
+    return (page->markBits[index / 64] >> (index % 64)) & 1;
+}
+
+// Documented in header.
+void heapIterate(void (*function)(void *memory)) {
+    for (zint i = 0; i < thePageCount; i++) {
+        HeapPage *page = thePages[i];
+
+        if (page->sizeClass == HEAP_SPARE_CLASS) {
+            continue;
+        }
+
+        for (zint j = 0; j < page->slotCount; j++) {
+            if ((page->allocBits[j / 64] >> (j % 64)) & 1) {
+                function(page->slots + (j * page->slotSize));
+            }
+        }
+    }
+}
+
+// Documented in header.
+zint heapMark(void *memory) {
+    HeapPage *page = pageOf(memory);
+    zint index = slotIndex(page, memory);
+    uint64_t *word = &page->markBits[index / 64];
+    uint64_t bit = (uint64_t) 1 << (index % 64);
+
+    // Check before setting, to avoid the (relatively costly) atomic
+    // operation in the common case of the value already being marked. The
+    // atomic is needed because several mark threads may share a word.
+    if (__atomic_load_n(word, __ATOMIC_RELAXED) & bit) {
+        return 0;
+    }
+
+    uint64_t old = __atomic_fetch_or(word, bit, __ATOMIC_RELAXED);
+    return (old & bit) ? 0 : page->slotSize;
+}
+
+// Documented in header.
+void heapSweepStart(void) {
+    if (theSweepCapacity < thePageCount) {
+        utilFree(theSweepList);
+        theSweepCapacity = thePagesCapacity;
+        theSweepList = utilAlloc(theSweepCapacity * sizeof(HeapPage *));
+    }
+
+    theSweepCount = 0;
+    for (zint i = 0; i < thePageCount; i++) {
+        HeapPage *page = thePages[i];
+
+        if (page->sizeClass != HEAP_SPARE_CLASS) {
+            page->sweepState = SWEEP_PENDING;
+            theSweepList[theSweepCount] = page;
+            theSweepCount++;
+        }
+    }
+
+    theSweepCursor = 0;
+    theSweptCount = 0;
+    theSweepActive = true;
+
+    if (!DAT_BACKGROUND_SWEEP) {
+        return;
+    }
+
+    if (!theSweeperStarted) {
+        pthread_t thread;
+
+        if (pthread_create(&thread, NULL, sweeperMain, NULL) != 0) {
+            die("Could not start gc sweeper thread.");
+        }
+
+        theSweeperStarted = true;
+    }
+
+    pthread_mutex_lock(&theSweepLock);
+    theSweepRound++;
+    pthread_cond_signal(&theSweepWake);
+    pthread_mutex_unlock(&theSweepLock);
+}
+
+// Documented in header.
+zint heapSweepFinish(void) {
+    if (!theSweepActive) {
+        return 0;
+    }
+
+    // Help out with whatever is left, and then wait for the sweeper thread
+    // to be done with whatever it's in the middle of.
+
+    sweepClaimed();
+
+    if (theSweeperStarted) {
+        pthread_mutex_lock(&theSweepLock);
+        while (theSweeperRound != theSweepRound) {
+            pthread_cond_wait(&theSweepDone, &theSweepLock);
+        }
+        pthread_mutex_unlock(&theSweepLock);
+    }
+
+    settleSwept();
+    theSweepActive = false;
+
+    return theSweptCount;
+}
+
+// Documented in header.
+void heapTrim(void) {
+    // Any spare pages that didn't get used since the last trim are
+    // evidently not needed, so release them.
+
+    for (zint i = theSpareLowWater; i > 0; i--) {
+        HeapPage *page = theSparePages;
+        theSparePages = page->next;
+        theSpareCount--;
+        releasePage(page);
+    }
+
+    theSpareLowWater = theSpareCount;
+}
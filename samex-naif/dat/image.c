@@ -0,0 +1,858 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Heap images
+//
+// An image is a snapshot of the values created after a "base" point, along
+// with enough information to rebuild them in a fresh process. Every value
+// gets an id. Ids are assigned by a breadth-first walk of the value graph,
+// starting with the base immortals, so the base values get the same ids in
+// every process that reaches the same base state. The values in an image
+// get the ids that follow, starting with any symbols made since the base
+// (in index order, since symbol indexes have to be preserved), then the
+// root, then any other immortals.
+//
+// Each value is written as its class id, payload size, and payload, along
+// with a list of "relocations," which say which payload slots hold
+// references, pointers into values, or pointers to static code or data.
+// Loading an image is just a matter of allocating all the values and then
+// filling them in, with no need to consult classes or run any code.
+// Relocations are found using class gc layouts, which is why those also
+// identify non-reference pointers.
+//
+// To verify that a process is in the same base state as the one that saved
+// an image, the base values are encoded the same way as the values in the
+// image, and the result is hashed.
+//
+
+// Needed for `dladdr()` when using glibc.
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "type/Class.h"
+#include "type/Symbol.h"
+#include "type/define.h"
+#include "util.h"
+
+#include "impl.h"
+
+
+//
+// Private Definitions
+//
+
+enum {
+    /** Relocation kind: reference to a value. */
+    RELOC_REF = 0,
+
+    /** Relocation kind: pointer into a value. */
+    RELOC_POINTER = 1,
+
+    /** Relocation kind: pointer to static code or data. */
+    RELOC_STATIC = 2,
+
+    /** Number of bits of a relocation's slot number used for its kind. */
+    RELOC_KIND_BITS = 2,
+
+    /** Image file format version. */
+    IMAGE_VERSION = 2
+};
+
+/** Magic number at the start of image files (`"SamImage"` in ASCII). */
+static const zint IMAGE_MAGIC = 0x53616d496d616765LL;
+
+/**
+ * Image file header. The header is followed by the ids of the immortals,
+ * and then by the value records.
+ */
+typedef struct {
+    /** Always `IMAGE_MAGIC`. */
+    zint magic;
+
+    /** Always `IMAGE_VERSION`. */
+    zint version;
+
+    /** Stamp, as passed to `datImageSave()`, combined with the runtime's. */
+    zint stamp;
+
+    /** Number of base immortals. */
+    zint baseImmortals;
+
+    /** Number of base symbols. */
+    zint baseSymbols;
+
+    /** Number of base values. */
+    zint baseCount;
+
+    /** Hash of the encoded base values. */
+    zint baseHash;
+
+    /** Number of values in the image. */
+    zint valueCount;
+
+    /** Number of values in the image which are symbols. */
+    zint symbolCount;
+
+    /** Number of immortals in the image, not including symbols. */
+    zint immortalCount;
+
+    /** Id of the root value. */
+    zint root;
+
+    /** Size of the value records, in `zint`s. */
+    zint dataSize;
+
+    /**
+     * Method binding epoch as of the save. Cached method lookups in the
+     * image are no later than this.
+     */
+    zint methodEpoch;
+} ImageHeader;
+
+/** Growable array of `zint`s, into which values get encoded. */
+typedef struct {
+    zint *elems;
+    zint size;
+    zint capacity;
+} ImageBuffer;
+
+/** Whether the base has been noted, and the base values can be traced. */
+static bool theHasBase = false;
+
+/** Number of base immortals. */
+static zint theBaseImmortals = 0;
+
+/** Number of base symbols. */
+static zint theBaseSymbols = 0;
+
+/** Number of base values. */
+static zint theBaseCount = 0;
+
+/** Hash of the encoded base values. */
+static zint theBaseHash = 0;
+
+/** All values found so far, in id order. */
+static zvalue *theValues = NULL;
+
+/** Number of values in `theValues`. */
+static zint theValueCount = 0;
+
+/** Allocated size of `theValues`. */
+static zint theValueCapacity = 0;
+
+/**
+ * Hash table of values, for finding ids. Open addressing, with the keys
+ * here and the corresponding ids in `theIds`.
+ */
+static zvalue *theKeys = NULL;
+
+/** Ids corresponding to `theKeys`. */
+static zint *theIds = NULL;
+
+/** Size of `theKeys` and `theIds`. Always a power of two. */
+static zint theTableSize = 0;
+
+/** Whether a value has been found that can't be encoded. */
+static bool theFailed = false;
+
+/**
+ * Gets the address relative to which pointers to static code or data are
+ * encoded.
+ */
+static char *anchor(void) {
+    return (char *) (intptr_t) datImageBase;
+}
+
+/**
+ * Returns whether the given pointer to static code or data can be encoded,
+ * which is the case if it is in the same binary as `anchor()`.
+ */
+static bool canEncodeStatic(void *pointer) {
+    Dl_info anchorInfo;
+    Dl_info info;
+
+    return (dladdr(anchor(), &anchorInfo) != 0)
+        && (dladdr(pointer, &info) != 0)
+        && (info.dli_fbase == anchorInfo.dli_fbase);
+}
+
+/**
+ * Combines the given stamp with one identifying the binary that contains
+ * `anchor()`, so that images made by a different build don't get used.
+ * Returns `false` if the binary can't be identified, in which case there's
+ * no telling whether an image's static pointers are valid.
+ */
+static bool fullStamp(zint *stamp) {
+    Dl_info info;
+    struct stat st;
+
+    if ((dladdr(anchor(), &info) == 0) || (info.dli_fname == NULL)) {
+        return false;
+    }
+
+    // A name without a slash is the main program as found via `PATH`,
+    // which can't be looked at directly.
+    const char *path = (strchr(info.dli_fname, '/') != NULL)
+        ? info.dli_fname
+        : "/proc/self/exe";
+
+    if (stat(path, &st) != 0) {
+        return false;
+    }
+
+    zint binary[2] = { st.st_size, st.st_mtime };
+    *stamp = utilHash(*stamp, binary, sizeof(binary));
+    return true;
+}
+
+/**
+ * Frees the value table.
+ */
+static void resetTable(void) {
+    utilFree(theValues);
+    utilFree(theKeys);
+    utilFree(theIds);
+    theValues = NULL;
+    theKeys = NULL;
+    theIds = NULL;
+    theValueCount = 0;
+    theValueCapacity = 0;
+    theTableSize = 0;
+    theFailed = false;
+}
+
+/**
+ * Gets the hash table index at which to start looking for the given value.
+ */
+static zint tableStart(zvalue value) {
+    uint64_t bits = (uint64_t) (intptr_t) value;
+    return (zint) ((bits >> 4) * 0x9e3779b97f4a7c15ULL) & (theTableSize - 1);
+}
+
+/**
+ * Gets the id of the given value, adding it to the table if not already
+ * there.
+ */
+static zint idOf(zvalue value) {
+    if ((theValueCount * 2) >= theTableSize) {
+        zint oldSize = theTableSize;
+        zvalue *oldKeys = theKeys;
+        zint *oldIds = theIds;
+
+        theTableSize = (oldSize == 0) ? 4096 : oldSize * 2;
+        theKeys = utilAlloc(theTableSize * sizeof(zvalue));
+        theIds = utilAlloc(theTableSize * sizeof(zint));
+
+        for (zint i = 0; i < oldSize; i++) {
+            if (oldKeys[i] != NULL) {
+                zint at = tableStart(oldKeys[i]);
+                while (theKeys[at] != NULL) {
+                    at = (at + 1) & (theTableSize - 1);
+                }
+                theKeys[at] = oldKeys[i];
+                theIds[at] = oldIds[i];
+            }
+        }
+
+        utilFree(oldKeys);
+        utilFree(oldIds);
+    }
+
+    zint at = tableStart(value);
+
+    while (theKeys[at] != NULL) {
+        if (theKeys[at] == value) {
+            return theIds[at];
+        }
+        at = (at + 1) & (theTableSize - 1);
+    }
+
+    if (theValueCount == theValueCapacity) {
+        zint newCapacity = theTableSize / 2;
+        zvalue *newValues = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (theValues != NULL) {
+            utilCpy(zvalue, newValues, theValues, theValueCount);
+            utilFree(theValues);
+        }
+
+        theValues = newValues;
+        theValueCapacity = newCapacity;
+    }
+
+    zint id = theValueCount;
+    theKeys[at] = value;
+    theIds[at] = id;
+    theValues[id] = value;
+    theValueCount++;
+
+    return id;
+}
+
+/**
+ * Appends a `zint` to the given buffer.
+ */
+static void bufferAdd(ImageBuffer *buf, zint value) {
+    if (buf->size == buf->capacity) {
+        zint newCapacity = (buf->capacity == 0) ? 1024 : buf->capacity * 2;
+        zint *newElems = utilAlloc(newCapacity * sizeof(zint));
+
+        if (buf->elems != NULL) {
+            utilCpy(zint, newElems, buf->elems, buf->size);
+            utilFree(buf->elems);
+        }
+
+        buf->elems = newElems;
+        buf->capacity = newCapacity;
+    }
+
+    buf->elems[buf->size] = value;
+    buf->size++;
+}
+
+/**
+ * Adds a relocation for the payload slot `slot` of the value whose payload
+ * starts at `buf->elems[dataAt]`. This also clears the slot, so that the
+ * encoded form doesn't depend on where anything happens to be in memory.
+ */
+static void addReloc(ImageBuffer *buf, zint dataAt, zint slot, zint kind,
+        zint target, zint addend) {
+    buf->elems[dataAt + slot] = 0;
+    bufferAdd(buf, (slot << RELOC_KIND_BITS) | kind);
+    bufferAdd(buf, target);
+    bufferAdd(buf, addend);
+}
+
+/**
+ * Finds the value that the given pointer (found in a payload slot of
+ * `value`) points into. Pointers to the very end of a value (e.g. to the
+ * elements of an empty array) are common, so candidates that `value`
+ * refers to are checked first, and then the heap is checked both at and
+ * just before the pointer.
+ */
+static zvalue pointerTarget(zvalue value, const zgcLayout *layout,
+        char *pointer) {
+    zvalue *slots = datPayload(value);
+    zint size;
+
+    if ((heapFind(value, &size) == value)
+            && (pointer >= (char *) slots)
+            && (pointer <= ((char *) value + size))) {
+        return value;
+    }
+
+    for (uint64_t f = layout->fields; f != 0; f &= f - 1) {
+        zvalue one = slots[__builtin_ctzll(f)];
+        if ((one != NULL)
+                && (heapFind(one, &size) == one)
+                && (pointer >= (char *) one)
+                && (pointer <= ((char *) one + size))) {
+            return one;
+        }
+    }
+
+    zvalue result = heapFind(pointer, NULL);
+    return (result != NULL) ? result : heapFind(pointer - 1, NULL);
+}
+
+/**
+ * Encodes the references in `value` per the given layout. `buf->elems`
+ * holds the payload starting at `dataAt`, with `words` slots. Returns the
+ * number of relocations added.
+ */
+static zint encodeLayout(ImageBuffer *buf, zvalue value,
+        const zgcLayout *layout, zint dataAt, zint words, bool checkStatics) {
+    zint *payload = datPayload(value);
+    zint relocs = 0;
+
+    if ((64 - __builtin_clzll(
+                layout->fields | layout->pointers | layout->statics | 1))
+            > words) {
+        theFailed = true;
+        return 0;
+    }
+
+    for (uint64_t f = layout->fields; f != 0; f &= f - 1) {
+        zint slot = __builtin_ctzll(f);
+        zvalue one = (zvalue) payload[slot];
+        if (one != NULL) {
+            addReloc(buf, dataAt, slot, RELOC_REF, idOf(one), 0);
+            relocs++;
+        }
+    }
+
+    if (layout->elementRefs != 0) {
+        char *base = (char *) payload;
+        zint count = (layout->elementCount != 0)
+            ? layout->elementCount
+            : *(zint *) (base + layout->countOffset);
+        char *elems = layout->arrayIndirect
+            ? *(char **) (base + layout->arrayOffset)
+            : base + layout->arrayOffset;
+        zint elemsSlot = (elems - base) / (zint) sizeof(zint);
+
+        // An indirect array that lives in some other value gets encoded
+        // along with that value.
+        if ((elems >= base) && (elems <= base + (words * sizeof(zint)))) {
+            zint step = layout->elementSize / sizeof(zint);
+
+            if ((elemsSlot + (count * step)) > words) {
+                theFailed = true;
+                return 0;
+            }
+
+            for (zint i = 0; i < count; i++) {
+                for (zint j = 0; j < layout->elementRefs; j++) {
+                    zint slot = elemsSlot + (i * step) + j;
+                    zvalue one = (zvalue) payload[slot];
+                    if (one != NULL) {
+                        addReloc(buf, dataAt, slot, RELOC_REF, idOf(one), 0);
+                        relocs++;
+                    }
+                }
+            }
+        }
+    }
+
+    for (uint64_t f = layout->pointers; f != 0; f &= f - 1) {
+        zint slot = __builtin_ctzll(f);
+        char *one = (char *) payload[slot];
+        if (one != NULL) {
+            zvalue target = pointerTarget(value, layout, one);
+            if (target == NULL) {
+                theFailed = true;
+                return 0;
+            }
+            addReloc(buf, dataAt, slot, RELOC_POINTER, idOf(target),
+                one - (char *) target);
+            relocs++;
+        }
+    }
+
+    for (uint64_t f = layout->statics; f != 0; f &= f - 1) {
+        zint slot = __builtin_ctzll(f);
+        char *one = (char *) payload[slot];
+        if (one != NULL) {
+            if (checkStatics && !canEncodeStatic(one)) {
+                theFailed = true;
+                return 0;
+            }
+            addReloc(buf, dataAt, slot, RELOC_STATIC, 0, one - anchor());
+            relocs++;
+        }
+    }
+
+    return relocs;
+}
+
+/**
+ * Encodes the given value onto the end of the given buffer, as its class id,
+ * payload size, relocation count, payload, and relocations. Any values it
+ * refers to get added to the table.
+ */
+static void encodeValue(ImageBuffer *buf, zvalue value, bool checkStatics) {
+    zint slotSize;
+
+    if (heapFind(value, &slotSize) != value) {
+        theFailed = true;
+        return;
+    }
+
+    zint size = slotSize - sizeof(DatHeader);
+    zint words = size / sizeof(zint);
+    zvalue cls = value->cls;
+    const zgcLayout *layout = classGcLayout(cls);
+
+    if ((layout == NULL)
+            && (classFindMethodUnchecked(cls, SYMIDX(gcMark)) != NULL)) {
+        // The class's references can't be found without running code.
+        theFailed = true;
+        return;
+    }
+
+    bufferAdd(buf, idOf(cls));
+    bufferAdd(buf, size);
+
+    zint countAt = buf->size;
+    bufferAdd(buf, 0);
+
+    zint dataAt = buf->size;
+    zint *payload = datPayload(value);
+    for (zint i = 0; i < words; i++) {
+        bufferAdd(buf, payload[i]);
+    }
+
+    if (layout != NULL) {
+        // Note: Encoding can grow (and so move) `buf->elems`, hence the
+        // separate statement.
+        zint relocs =
+            encodeLayout(buf, value, layout, dataAt, words, checkStatics);
+        buf->elems[countAt] = relocs;
+    }
+}
+
+/**
+ * Encodes all the values in the table starting with the one with the given
+ * id, including any that get added along the way. If `keep` is `false`,
+ * the encoded values aren't kept in `buf`. If `hash` is non-`NULL`, the
+ * encoded values are hashed into it.
+ */
+static void encodeFrom(ImageBuffer *buf, zint id, bool keep,
+        bool checkStatics, zint *hash) {
+    for (/*id*/; (id < theValueCount) && !theFailed; id++) {
+        zint start = buf->size;
+        encodeValue(buf, theValues[id], checkStatics);
+
+        if (hash != NULL) {
+            *hash = utilHash(*hash, &buf->elems[start],
+                (buf->size - start) * sizeof(zint));
+        }
+
+        if (!keep) {
+            buf->size = start;
+        }
+    }
+}
+
+/**
+ * Builds the table of base values from scratch, and hashes them. Returns
+ * `false` if the base values couldn't all be encoded.
+ */
+static bool tableBase(zint *hash) {
+    ImageBuffer buf = { NULL, 0, 0 };
+
+    resetTable();
+
+    for (zint i = 0; i < theBaseImmortals; i++) {
+        idOf(allocImmortal(i));
+    }
+
+    *hash = 0;
+    encodeFrom(&buf, 0, false, false, hash);
+    utilFree(buf.elems);
+
+    return !theFailed;
+}
+
+/**
+ * Reads and validates an image file. On success, returns the allocated
+ * contents after the header (which must be freed by the caller) and fills
+ * in `header`. On failure, returns `NULL`.
+ */
+static zint *readImage(const char *path, zint stamp, ImageHeader *header) {
+    FILE *in = fopen(path, "rb");
+
+    if (in == NULL) {
+        return NULL;
+    }
+
+    zint *result = NULL;
+    long fileSize = -1;
+
+    if (fseek(in, 0, SEEK_END) == 0) {
+        fileSize = ftell(in);
+        rewind(in);
+    }
+
+    if ((fread(header, sizeof(ImageHeader), 1, in) == 1)
+            && (header->magic == IMAGE_MAGIC)
+            && (header->version == IMAGE_VERSION)
+            && (header->stamp == stamp)
+            && (header->baseImmortals == theBaseImmortals)
+            && (header->baseSymbols == theBaseSymbols)
+            && (header->baseCount == theBaseCount)
+            && (header->baseHash == theBaseHash)
+            && (header->valueCount >= 0)
+            && (header->symbolCount >= 0)
+            && (header->symbolCount <= header->valueCount)
+            && (header->immortalCount >= 0)
+            && (header->dataSize >= 0)
+            && ((fileSize - (long) sizeof(ImageHeader))
+                == ((header->immortalCount + header->dataSize)
+                    * (long) sizeof(zint)))) {
+        zint size = header->immortalCount + header->dataSize;
+        result = utilAlloc(size * sizeof(zint));
+
+        if (fread(result, sizeof(zint), size, in) != (size_t) size) {
+            utilFree(result);
+            result = NULL;
+        }
+    }
+
+    fclose(in);
+    return result;
+}
+
+/**
+ * Validates the value records in an image, filling in `records` with the
+ * offset of each. Returns `true` if they're all valid.
+ */
+static bool validateRecords(const ImageHeader *header, const zint *data,
+        zint *records) {
+    zint total = theBaseCount + header->valueCount;
+    zint dataSize = header->dataSize;
+    zint at = 0;
+
+    for (zint i = 0; i < header->valueCount; i++) {
+        if ((dataSize - at) < 3) {
+            return false;
+        }
+
+        zint cls = data[at];
+        zint size = data[at + 1];
+        zint relocs = data[at + 2];
+        zint words = size / sizeof(zint);
+
+        if ((cls < 0) || (cls >= total)
+                || (size < 0) || ((size % sizeof(zint)) != 0)
+                || (relocs < 0)
+                || (words > (dataSize - at - 3))
+                || (relocs > ((dataSize - at - 3 - words) / 3))) {
+            return false;
+        }
+
+        records[i] = at;
+        at += 3 + words;
+
+        for (zint j = 0; j < relocs; j++, at += 3) {
+            zint slot = data[at] >> RELOC_KIND_BITS;
+            zint kind = data[at] & ((1 << RELOC_KIND_BITS) - 1);
+            zint target = data[at + 1];
+
+            if ((slot < 0) || (slot >= words) || (kind > RELOC_STATIC)
+                    || ((kind == RELOC_REF) && (data[at + 2] != 0))
+                    || ((kind != RELOC_STATIC)
+                        && ((target < 0) || (target >= total)))) {
+                return false;
+            }
+        }
+    }
+
+    return (at == dataSize);
+}
+
+/**
+ * Does the main work of `datImageLoad()`.
+ */
+static zvalue loadImage(const char *path, zint stamp) {
+    if (!theHasBase
+            || (allocImmortalCount() != theBaseImmortals)
+            || (symbolCount() != theBaseSymbols)) {
+        return NULL;
+    }
+
+    ImageHeader header;
+    zint *contents = readImage(path, stamp, &header);
+
+    if (contents == NULL) {
+        return NULL;
+    }
+
+    zint *immortals = contents;
+    zint *data = contents + header.immortalCount;
+    zint total = theBaseCount + header.valueCount;
+    zint *records = utilAlloc(header.valueCount * sizeof(zint));
+    bool valid = validateRecords(&header, data, records)
+        && (header.root >= 0) && (header.root < total);
+
+    for (zint i = 0; valid && (i < header.immortalCount); i++) {
+        valid = (immortals[i] >= 0) && (immortals[i] < total);
+    }
+
+    for (zint i = 0; valid && (i < header.symbolCount); i++) {
+        zint cls = data[records[i]];
+        valid = (cls < theBaseCount) && (theValues[cls] == CLS_Symbol);
+    }
+
+    if (!valid) {
+        utilFree(records);
+        utilFree(contents);
+        return NULL;
+    }
+
+    // Everything checks out. Allocate all the values, and then fill them in.
+
+    zvalue *values = utilAlloc(total * sizeof(zvalue));
+    utilCpy(zvalue, values, theValues, theBaseCount);
+
+    for (zint i = 0; i < header.valueCount; i++) {
+        values[theBaseCount + i] =
+            allocValueUnrooted(NULL, data[records[i] + 1]);
+    }
+
+    for (zint i = 0; i < header.valueCount; i++) {
+        zint *record = &data[records[i]];
+        zint words = record[1] / sizeof(zint);
+        zint *relocs = &record[3 + words];
+        zvalue value = values[theBaseCount + i];
+        zint *payload = datPayload(value);
+
+        value->cls = values[record[0]];
+        utilCpy(zint, payload, &record[3], words);
+
+        for (zint j = 0; j < record[2]; j++, relocs += 3) {
+            zint slot = relocs[0] >> RELOC_KIND_BITS;
+            zint target = relocs[1];
+            zint addend = relocs[2];
+            zint kind = relocs[0] & ((1 << RELOC_KIND_BITS) - 1);
+            char *pointer = (kind == RELOC_STATIC)
+                ? anchor() + addend
+                : (char *) values[target] + addend;
+
+            payload[slot] = (zint) (intptr_t) pointer;
+        }
+    }
+
+    for (zint i = 0; i < header.symbolCount; i++) {
+        symbolRegister(values[theBaseCount + i]);
+    }
+
+    for (zint i = 0; i < header.immortalCount; i++) {
+        datImmortalize(values[immortals[i]]);
+    }
+
+    // Make sure none of the cached method lookups in the image get mistaken
+    // for ones made in this process.
+    classAdvanceMethodEpoch(header.methodEpoch);
+
+    zvalue result = values[header.root];
+    datFrameAdd(result);
+
+    utilFree(values);
+    utilFree(records);
+    utilFree(contents);
+    return result;
+}
+
+/**
+ * Writes an image file, via a temporary file so that a reader never sees a
+ * partially-written image. Returns `true` on success.
+ */
+static bool writeImage(const char *path, const ImageHeader *header,
+        const ImageBuffer *immortals, const ImageBuffer *data) {
+    char *tempPath = utilFormat("%s.%d.tmp", path, (int) getpid());
+    FILE *out = fopen(tempPath, "wb");
+    bool ok = (out != NULL);
+
+    if (ok) {
+        ok = (fwrite(header, sizeof(ImageHeader), 1, out) == 1)
+            && (fwrite(immortals->elems, sizeof(zint), immortals->size, out)
+                == (size_t) immortals->size)
+            && (fwrite(data->elems, sizeof(zint), data->size, out)
+                == (size_t) data->size);
+        ok = (fclose(out) == 0) && ok;
+        ok = ok && (rename(tempPath, path) == 0);
+
+        if (!ok) {
+            remove(tempPath);
+        }
+    }
+
+    utilFree(tempPath);
+    return ok;
+}
+
+
+//
+// Exported Definitions
+//
+
+// Documented in header.
+void datImageBase(void) {
+    allocFinishSweep();
+
+    theBaseImmortals = allocImmortalCount();
+    theBaseSymbols = symbolCount();
+    theHasBase = tableBase(&theBaseHash);
+    theBaseCount = theValueCount;
+}
+
+// Documented in header.
+zvalue datImageLoad(const char *path, zint stamp) {
+    if (!fullStamp(&stamp)) {
+        return NULL;
+    }
+
+    zvalue result = loadImage(path, stamp);
+
+    // The table is rebuilt from scratch if an image gets saved, so there's
+    // no reason to keep it around.
+    resetTable();
+
+    return result;
+}
+
+// Documented in header.
+bool datImageSave(const char *path, zint stamp, zvalue root) {
+    if (!theHasBase || !fullStamp(&stamp)) {
+        return false;
+    }
+
+    // Make sure the base is as it was. If any base value has been changed
+    // to refer to a new value, then the new value will have been found
+    // here as a base value, making for a different count.
+
+    zint hash;
+    allocFinishSweep();
+
+    if (!tableBase(&hash)
+            || (theValueCount != theBaseCount)
+            || (hash != theBaseHash)) {
+        resetTable();
+        return false;
+    }
+
+    zint symbols = symbolCount() - theBaseSymbols;
+    for (zint i = 0; i < symbols; i++) {
+        idOf(symbolFromIndex(theBaseSymbols + i));
+    }
+
+    zint rootId = idOf(root);
+    ImageBuffer immortals = { NULL, 0, 0 };
+
+    for (zint i = theBaseImmortals; i < allocImmortalCount(); i++) {
+        zvalue one = allocImmortal(i);
+        if (classOf(one) != CLS_Symbol) {
+            bufferAdd(&immortals, idOf(one));
+        }
+    }
+
+    ImageBuffer data = { NULL, 0, 0 };
+    encodeFrom(&data, theBaseCount, true, true, NULL);
+
+    bool ok = !theFailed;
+
+    if (ok) {
+        ImageHeader header = {
+            .magic = IMAGE_MAGIC,
+            .version = IMAGE_VERSION,
+            .stamp = stamp,
+            .baseImmortals = theBaseImmortals,
+            .baseSymbols = theBaseSymbols,
+            .baseCount = theBaseCount,
+            .baseHash = theBaseHash,
+            .valueCount = theValueCount - theBaseCount,
+            .symbolCount = symbols,
+            .immortalCount = immortals.size,
+            .root = rootId,
+            .dataSize = data.size,
+            .methodEpoch = classMethodEpoch()
+        };
+
+        ok = writeImage(path, &header, &immortals, &data);
+    }
+
+    utilFree(immortals.elems);
+    utilFree(data.elems);
+    resetTable();
+
+    return ok;
+}
@@ -14,8 +14,18 @@
 
 
 enum {
-    /** Number of allocations between each forced gc. */
-    DAT_ALLOCATIONS_PER_GC = 500000,
+    /**
+     * Whether to sweep in a background thread. If `false`, sweeping is done
+     * lazily, by the allocator, as it needs pages.
+     */
+    DAT_BACKGROUND_SWEEP = true,
+
+    /**
+     * Number of innermost method calls to keep in the call trace, which is
+     * what gets reported as context when dying. Must be a power of two.
+     * Only half of these get reported. Not used when `DAT_FULL_TRACE` is on.
+     */
+    DAT_CALL_TRACE_SIZE = 4096,
 
     /** Whether to spew to the console during gc. */
     DAT_CHATTY_GC = false,
@@ -23,14 +33,96 @@ enum {
     /** Whether to be paranoid about values in collections / records. */
     DAT_CONSTRUCTION_PARANOIA = false,
 
+    /**
+     * Maximum number of references in a single frame stack segment. Segments
+     * double in size as the stack grows, up to this size.
+     */
+    DAT_FRAME_SEGMENT_MAX = 1024 * 1024,
+
+    /** Number of references in the first frame stack segment. */
+    DAT_FRAME_SEGMENT_MIN = 4096,
+
+    /**
+     * Whether to link each method call into the giblet stack, instead of
+     * just recording it in the call trace. This reports every call (not
+     * just the innermost `DAT_CALL_TRACE_SIZE`) when dying, at the cost of
+     * extra work per call.
+     */
+    DAT_FULL_TRACE = false,
+
+    /**
+     * Default heap growth factor, as a percentage. Once the heap grows to
+     * this much of the size that survived the last gc, another gc is done.
+     * With the generational collector, this is also how much the tenured
+     * space may grow past its size as of the last full gc, before another
+     * full gc is done.
+     */
+    DAT_GC_GROWTH_PERCENT = 200,
+
+    /**
+     * Default number of threads to use for marking, including the thread
+     * that triggered the gc. `0` means one per available CPU.
+     */
+    DAT_GC_MARK_THREADS = 0,
+
+    /**
+     * Default hard ceiling on the heap size, in bytes. `0` means that there
+     * is no ceiling.
+     */
+    DAT_GC_MAX_BYTES = 0,
+
+    /**
+     * Default minimum number of bytes to allow to be allocated between
+     * gcs.
+     */
+    DAT_GC_MIN_BYTES = 32 * 1024 * 1024,
+
+    /**
+     * How many array elements ahead to prefetch, when marking the array
+     * part of a value with a gc layout.
+     */
+    DAT_GC_PREFETCH_DISTANCE = 8,
+
+    /**
+     * Number of bytes to allow to be allocated between slices of an
+     * incremental gc.
+     */
+    DAT_GC_SLICE_BYTES = 512 * 1024,
+
+    /** Maximum number of values to trace in one slice of an incremental gc. */
+    DAT_GC_SLICE_VALUES = 20000,
+
+    /**
+     * Whether to use the generational (nursery plus tenured space)
+     * collector. If `false`, every gc is a full collection.
+     */
+    DAT_GENERATIONAL_GC = true,
+
+    /**
+     * Largest allocation (in bytes) served from a shared size-class page.
+     * Anything bigger gets a page of its own.
+     */
+    DAT_HEAP_MAX_SMALL = 8192,
+
+    /**
+     * Size (and alignment) in bytes of a heap page. Must be a power of two.
+     */
+    DAT_HEAP_PAGE_SIZE = 65536,
+
+    /**
+     * Whether to do full gcs incrementally by default, that is, in slices
+     * interleaved with running the program, instead of all at once.
+     */
+    DAT_INCREMENTAL_GC = false,
+
     /** Largest code point to keep a cached single-character string for. */
     DAT_MAX_CACHED_CHAR = 127,
 
-    /** Maximum number of immortal values allowed. */
-    DAT_MAX_IMMORTALS = 10000,
+    /** Initial size of each mark thread's deque. Must be a power of two. */
+    DAT_MARK_DEQUE_SIZE = 1024,
 
-    /** Maximum number of references on the stack. */
-    DAT_MAX_STACK = 100000,
+    /** Maximum number of gc mark threads. */
+    DAT_MAX_MARK_THREADS = 64,
 
     /**
      * Maximum size in characters of a string that can be handled
@@ -44,6 +136,11 @@ enum {
     /** Whether to be paranoid about corruption checks. */
     DAT_MEMORY_PARANOIA = false,
 
+    /**
+     * Number of entries in the global method cache. Must be a power of two.
+     */
+    DAT_METHOD_CACHE_SIZE = 4096,
+
     /** Maximum (highest value) small int constant to keep. */
     DAT_SMALL_INT_MAX = 700,
 
@@ -67,54 +164,70 @@ enum {
 };
 
 /**
- * "Colors" used for gc marking. This is used instead of a boolean so that
- * we can flip the sense of marked-vs-not without actually having to flip a
- * bunch of bits in live objects.
- */
-typedef enum {
-    MARK_AZURE,
-    MARK_MAUVE
-} zmarkColor;
-
-/**
- * Common fields across all values. Used as a header for other types.
+ * Common fields across all values. Used as a header for other types. Mark
+ * bits aren't kept here; they live in side bitmaps in the heap pages.
  *
  * **Note:** This must match the definition of `DatHeaderExposed` in `dat.h`.
  */
 typedef struct DatHeader {
-    /**
-     * Forward circular link. Every value is linked into a circularly
-     * linked list, which identifies its current fate / classification.
-     */
-    zvalue next;
-
-    /** Backward circular link. */
-    zvalue prev;
-
     /** Class of the value. This is always a `Class` instance. */
     zvalue cls;
 
-    /** Mark bit (used during GC). */
-    zmarkColor mark : 1;
+    /** Whether the value is in the remembered set (used during GC). */
+    bool remembered : 1;
 
     /** Class-specific data goes here. */
     void *payload[/*flexible*/];
 } DatHeader;
 
 
+/**
+ * Finishes off any sweeping left over from the last gc, so that the heap
+ * holds only live values plus any allocated since.
+ */
+void allocFinishSweep(void);
+
+/**
+ * Gets the immortal value with the given index, in the order they were
+ * made immortal.
+ */
+zvalue allocImmortal(zint index);
+
+/**
+ * Gets the number of immortal values.
+ */
+zint allocImmortalCount(void);
+
+/**
+ * Like `datAllocValue()`, except that the result is *not* added to the live
+ * reference stack, and this never triggers a gc. The caller must arrange
+ * for the result to be rooted before anything else allocates.
+ */
+zvalue allocValueUnrooted(zvalue cls, zint extraBytes);
+
 /**
  * Implementation of method `Builtin.call()`. This is used in the code
- * for `methCall()` to avoid infinite recursion. **Note:** Assumes that
- * `function` is in fact an instance of `Builtin`.
+ * for `methCall()` to avoid infinite recursion. Arguments are passed per the
+ * `zfunction` calling convention, that is, with the first argument (if any)
+ * separate from the rest. **Note:** Assumes that `function` is in fact an
+ * instance of `Builtin`.
  */
-zvalue builtinCall(zvalue function, zarray args);
+zvalue builtinCall(zvalue function, zvalue first, zarray rest);
 
 /**
- * Short-circuit to call the `.gcMark()` method on `value`, if it has one.
- * Does nothing if not.
+ * Marks the values referred to by `value`, either directly per its class's
+ * gc layout or by calling its `.gcMark()` method. Does nothing if it has
+ * neither.
  */
 void callGcMark(zvalue value);
 
+/**
+ * Advances the method binding epoch to be later than both the current one
+ * and the given one. This is used when loading values whose cached method
+ * lookups were made under a different process's epochs.
+ */
+void classAdvanceMethodEpoch(zint epoch);
+
 /**
  * Binds all the methods of a class. Either `*Methods` argument can be
  * `NULL`, in which case it is treated as `@{}` (the empty symbol table).
@@ -125,6 +238,12 @@ void callGcMark(zvalue value);
  */
 void classBindMethods(zvalue cls, zvalue classMethods, zvalue instanceMethods);
 
+/**
+ * Gets the gc layout of instances of the given class, if it has one.
+ * Returns `NULL` if not. Does not check to see if `cls` is actually a class.
+ */
+const zgcLayout *classGcLayout(zvalue cls);
+
 /**
  * Finds a method on a class, if bound. Returns the bound function if found
  * or `NULL` if not. Does not check to see if `cls` is actually a class,
@@ -132,18 +251,160 @@ void classBindMethods(zvalue cls, zvalue classMethods, zvalue instanceMethods);
  */
 zvalue classFindMethodUnchecked(zvalue cls, zint index);
 
+/**
+ * Clears out the global method cache. This needs to be called after every
+ * gc, since the memory of a freed class may get reused for a new one.
+ * (Changes to method bindings are handled separately, via the method
+ * binding epoch.)
+ */
+void classFlushMethodCache(void);
+
+/**
+ * Gets the most recently issued method binding epoch. No class's epoch
+ * (per `classMethodEpochOf()`) is later than this.
+ */
+zint classMethodEpoch(void);
+
+/**
+ * Gets the method binding epoch of the given class. This changes whenever
+ * methods get bound on the class or (during bootstrap) on one of its
+ * ancestors, so cached method lookups on the class are only valid if made
+ * during its current epoch. Does not check to see if `cls` is actually a
+ * class.
+ */
+zint classMethodEpochOf(zvalue cls);
+
+/**
+ * Allocates zeroed-out memory of the indicated size (in bytes) from the
+ * value heap.
+ */
+void *heapAlloc(zint size);
+
+/**
+ * Finds the heap allocation that contains the given address, returning a
+ * pointer to its start, or `NULL` if the address isn't within any current
+ * allocation. If `size` is non-`NULL`, it gets set to the size of the
+ * allocation.
+ */
+void *heapFind(void *memory, zint *size);
+
+/**
+ * Gets the number of bytes currently allocated from the value heap. This
+ * includes per-slot slack due to size class rounding. While sweeping is in
+ * progress, this may include allocations that are about to be freed.
+ */
+zint heapBytesInUse(void);
+
+/**
+ * Clears the mark bits of all heap allocations. This is done at the start of
+ * a full gc.
+ */
+void heapClearMarks(void);
+
+/**
+ * Returns whether the given pointer is the start of a live allocation made
+ * by `heapAlloc`. This is meant for validation, and is relatively slow.
+ */
+bool heapIsAllocated(void *memory);
+
+/**
+ * Returns whether the given heap allocation is marked. Mark bits stay set
+ * between gcs, so outside of gc this indicates whether the allocation
+ * survived a gc (that is, whether it is tenured).
+ */
+bool heapIsMarked(void *memory);
+
+/**
+ * Calls the given function on every live heap allocation.
+ */
+void heapIterate(void (*function)(void *memory));
+
+/**
+ * Sets the mark bit of the given heap allocation. Returns the size of the
+ * allocation in bytes (including slack) if the bit was not already set, or
+ * `0` if it was. This is safe to call from multiple threads at once.
+ */
+zint heapMark(void *memory);
+
+/**
+ * Starts freeing all heap allocations whose mark bits are not set. This
+ * happens in the background, and mark bits must not be changed until
+ * `heapSweepFinish()` has been called.
+ */
+void heapSweepStart(void);
+
+/**
+ * Finishes off the sweeping started by `heapSweepStart()`, if any, waiting
+ * for it if necessary. Returns the number of allocations freed.
+ */
+zint heapSweepFinish(void);
+
+/**
+ * Hands spare heap pages back to the OS, if they have gone unused since the
+ * last call to this function. This is meant to be called once per gc cycle,
+ * before calling `heapSweepStart()`.
+ */
+void heapTrim(void);
+
 /**
  * Marks all the references on the frame stack. Returns the number of
  * references marked.
  */
 zint markFrameStack(void);
 
+/**
+ * Marks the values referred to by `value`, as described by `layout`.
+ */
+void markLayout(zvalue value, const zgcLayout *layout);
+
+/**
+ * Traces up to `budget` values that have been marked (via `datMark()`) but
+ * not yet traced, on the current thread only. Returns `true` if that
+ * finished off all the tracing to be done.
+ */
+bool markTraceSome(zint budget);
+
+/**
+ * Traces all the values that have been marked (via `datMark()`) but not yet
+ * traced, along with everything reachable from them, using the configured
+ * number of mark threads. Returns the number of values marked since the last
+ * call to this function, and stores the number of bytes they occupy into
+ * `*markedBytes`.
+ */
+zint markTraceAll(zint *markedBytes);
+
+/**
+ * Adds all the tenured references on the frame stack to the remembered set.
+ * This is done at the end of each gc, because values still under
+ * construction get written to without a write barrier.
+ */
+void rememberFrameStack(void);
+
+/**
+ * Gets the number of symbols that have been made so far. This is also the
+ * index that the next symbol to be made will get.
+ */
+zint symbolCount(void);
+
+/**
+ * Registers a symbol whose payload was filled in directly (by loading a heap
+ * image), rather than by making it in the usual way. Symbols have to be
+ * registered in index order. This also makes the symbol immortal.
+ */
+void symbolRegister(zvalue symbol);
+
 /**
  * Gets the value for the given symbol key in the given symbol table.
  * Does not check to see if `symtab` is in fact a symbol table.
  */
 zvalue symtabGetUnchecked(zvalue symtab, zvalue key);
 
+/**
+ * Frees frame stack segments that are no longer in use, other than one
+ * kept in reserve. This is done at the end of each gc.
+ */
+void trimFrameStack(void);
+
 
 //
 // Object model initialization. These functions are needed in order to
@@ -158,6 +419,7 @@ void bindMethodsForCore(void);
 void bindMethodsForSymbol(void);
 void bindMethodsForSymbolTable(void);
 void bindMethodsForValue(void);
+void initCallTrace(void);
 void initCoreSymbols(void);
 
 #endif
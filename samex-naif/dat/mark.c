@@ -0,0 +1,542 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Parallel marking
+//
+// Tracing is done by a pool of mark threads, one of which is always the
+// thread that triggered the gc. Each thread has its own work-stealing deque
+// (per Chase and Lev) of values that have been marked but not yet traced.
+// A thread pushes and pops at the "bottom" of its own deque, and when that
+// runs dry it steals from the "top" of some other thread's deque. Marking
+// is over once all the threads are simultaneously idle.
+//
+// The mutator is stopped throughout, and `gcMark` methods must do nothing
+// other than read their value's payload and call `datMark()`. Values whose
+// class has a gc layout are traced directly from the layout, without calling
+// any method, prefetching referents ahead of marking them.
+//
+
+#define _XOPEN_SOURCE 700
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "impl.h"
+
+
+//
+// Private Definitions
+//
+
+/** Backing array of a mark deque. */
+typedef struct MarkArray {
+    /** Number of elements. Always a power of two. */
+    zint size;
+
+    /** Previous (smaller) array, which may still be in use by a thief. */
+    struct MarkArray *retired;
+
+    /** The elements. */
+    zvalue elems[/*size*/];
+} MarkArray;
+
+/** Per-thread marking state. */
+typedef struct {
+    /** Index of the next slot to steal from. Only ever incremented. */
+    zint top;
+
+    /** Index of the next slot to push into. Only written by the owner. */
+    zint bottom;
+
+    /** Current backing array. Only replaced by the owner. */
+    MarkArray *array;
+
+    /** Number of values marked (and pushed) by this thread. */
+    zint markedCount;
+
+    /** Number of bytes occupied by the values marked by this thread. */
+    zint markedBytes;
+
+    /** Whether a thread has been started for this worker. */
+    bool started;
+
+    /** The thread, if `started`. */
+    pthread_t thread;
+} MarkWorker;
+
+/**
+ * All the workers. The first one belongs to the mutator thread, and the rest
+ * get their own threads, which get started on demand.
+ */
+static MarkWorker workers[DAT_MAX_MARK_THREADS];
+
+/** The worker belonging to the current thread. */
+static __thread MarkWorker *thisWorker = &workers[0];
+
+/**
+ * Configured number of mark threads, including the mutator thread. `0`
+ * indicates that it has yet to be figured out.
+ */
+static zint threadCount = DAT_GC_MARK_THREADS;
+
+/** Number of worker threads that have been started. */
+static zint startedCount = 0;
+
+/** Lock for all the pool coordination variables. */
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Condition signaled when there is a new round of marking to do. */
+static pthread_cond_t poolWake = PTHREAD_COND_INITIALIZER;
+
+/** Condition signaled when a worker thread is done with a round. */
+static pthread_cond_t poolDone = PTHREAD_COND_INITIALIZER;
+
+/** Round number, incremented each time worker threads get woken up. */
+static zint markRound = 0;
+
+/** Number of worker threads that have finished the current round. */
+static zint finishedCount = 0;
+
+/** Number of threads participating in the current round. */
+static zint activeCount = 1;
+
+/** Number of participating threads that have run out of work. */
+static zint idleCount = 0;
+
+/**
+ * Allocates a deque backing array of the given size.
+ */
+static MarkArray *newArray(zint size, MarkArray *retired) {
+    MarkArray *result =
+        utilAlloc(sizeof(MarkArray) + size * sizeof(zvalue));
+
+    result->size = size;
+    result->retired = retired;
+    return result;
+}
+
+/**
+ * Pushes a value onto the bottom of the given (owned) deque, growing it if
+ * necessary.
+ */
+static void dequePush(MarkWorker *w, zvalue value) {
+    zint b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED);
+    zint t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    MarkArray *a = w->array;
+
+    if ((b - t) >= a->size) {
+        // Full. Copy into a bigger array. The old one is kept around until
+        // the end of marking, because a thief may be in the middle of
+        // reading from it.
+        MarkArray *newA = newArray(a->size * 2, a);
+
+        for (zint i = t; i < b; i++) {
+            newA->elems[i & (newA->size - 1)] = a->elems[i & (a->size - 1)];
+        }
+
+        __atomic_store_n(&w->array, newA, __ATOMIC_RELEASE);
+        a = newA;
+    }
+
+    __atomic_store_n(&a->elems[b & (a->size - 1)], value, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * Pops a value from the bottom of the given (owned) deque. Returns `NULL` if
+ * it is empty.
+ */
+static zvalue dequeTake(MarkWorker *w) {
+    zint b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED) - 1;
+    MarkArray *a = w->array;
+
+    __atomic_store_n(&w->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    zint t = __atomic_load_n(&w->top, __ATOMIC_RELAXED);
+
+    if (t > b) {
+        // Empty.
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    zvalue result =
+        __atomic_load_n(&a->elems[b & (a->size - 1)], __ATOMIC_RELAXED);
+
+    if (t == b) {
+        // Last element. Race against thieves for it.
+        if (!__atomic_compare_exchange_n(&w->top, &t, t + 1, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            result = NULL;
+        }
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+
+    return result;
+}
+
+/**
+ * Steals a value from the top of the given (not owned) deque. Returns `NULL`
+ * if it is empty or if another thread won the race for the value.
+ */
+static zvalue dequeSteal(MarkWorker *w) {
+    zint t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    zint b = __atomic_load_n(&w->bottom, __ATOMIC_ACQUIRE);
+
+    if (t >= b) {
+        return NULL;
+    }
+
+    MarkArray *a = __atomic_load_n(&w->array, __ATOMIC_ACQUIRE);
+    zvalue result =
+        __atomic_load_n(&a->elems[t & (a->size - 1)], __ATOMIC_RELAXED);
+
+    if (!__atomic_compare_exchange_n(&w->top, &t, t + 1, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+
+    return result;
+}
+
+/**
+ * Returns whether the given deque looks like it has anything in it.
+ */
+static bool dequeHasWork(MarkWorker *w) {
+    return __atomic_load_n(&w->top, __ATOMIC_ACQUIRE)
+        < __atomic_load_n(&w->bottom, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * Tries to steal a value from any worker other than the given one.
+ */
+static zvalue stealAny(zint self) {
+    for (zint i = 1; i < activeCount; i++) {
+        zvalue result = dequeSteal(&workers[(self + i) % activeCount]);
+
+        if (result != NULL) {
+            return result;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Returns whether any participating worker looks like it has work.
+ */
+static bool anyHasWork(void) {
+    for (zint i = 0; i < activeCount; i++) {
+        if (dequeHasWork(&workers[i])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Traces values until there are none left anywhere, as part of a parallel
+ * round of marking.
+ */
+static void traceShared(zint self) {
+    MarkWorker *w = &workers[self];
+
+    for (;;) {
+        zvalue value = dequeTake(w);
+
+        if (value == NULL) {
+            value = stealAny(self);
+        }
+
+        if (value != NULL) {
+            callGcMark(value);
+            continue;
+        }
+
+        // Nothing to do. Marking is done once all threads are idle at the
+        // same time, since only a non-idle thread can produce more work.
+
+        __atomic_add_fetch(&idleCount, 1, __ATOMIC_SEQ_CST);
+
+        for (;;) {
+            if (__atomic_load_n(&idleCount, __ATOMIC_SEQ_CST) == activeCount) {
+                return;
+            }
+
+            if (anyHasWork()) {
+                __atomic_sub_fetch(&idleCount, 1, __ATOMIC_SEQ_CST);
+                break;
+            }
+
+            sched_yield();
+        }
+    }
+}
+
+/**
+ * Main function of a worker thread.
+ */
+static void *workerMain(void *arg) {
+    zint self = (zint) (intptr_t) arg;
+    zint seenRound = 0;
+
+    thisWorker = &workers[self];
+    pthread_mutex_lock(&poolLock);
+
+    for (;;) {
+        while (markRound == seenRound) {
+            pthread_cond_wait(&poolWake, &poolLock);
+        }
+
+        seenRound = markRound;
+        bool participating = (self < activeCount);
+        pthread_mutex_unlock(&poolLock);
+
+        if (participating) {
+            traceShared(self);
+        }
+
+        pthread_mutex_lock(&poolLock);
+        finishedCount++;
+        pthread_cond_signal(&poolDone);
+    }
+
+    return NULL;
+}
+
+/**
+ * Starts worker threads as needed, so that there are enough for the
+ * configured thread count.
+ */
+static void startWorkers(void) {
+    for (/*startedCount*/; (startedCount + 1) < threadCount; startedCount++) {
+        zint index = startedCount + 1;
+        MarkWorker *w = &workers[index];
+
+        w->array = newArray(DAT_MARK_DEQUE_SIZE, NULL);
+
+        if (pthread_create(&w->thread, NULL, workerMain,
+                (void *) (intptr_t) index) != 0) {
+            die("Could not start gc mark thread.");
+        }
+
+        w->started = true;
+    }
+}
+
+/**
+ * Traces values on the mutator thread only.
+ */
+static void traceSerial(void) {
+    MarkWorker *w = &workers[0];
+    zvalue value;
+
+    while ((value = dequeTake(w)) != NULL) {
+        callGcMark(value);
+    }
+}
+
+/**
+ * Traces values using all the configured threads.
+ */
+static void traceParallel(void) {
+    startWorkers();
+
+    pthread_mutex_lock(&poolLock);
+    activeCount = threadCount;
+    idleCount = 0;
+    finishedCount = 0;
+    markRound++;
+    pthread_cond_broadcast(&poolWake);
+    pthread_mutex_unlock(&poolLock);
+
+    traceShared(0);
+
+    pthread_mutex_lock(&poolLock);
+    while (finishedCount != startedCount) {
+        pthread_cond_wait(&poolDone, &poolLock);
+    }
+    activeCount = 1;
+    pthread_mutex_unlock(&poolLock);
+}
+
+/**
+ * Frees the retired backing arrays of all the deques.
+ */
+static void freeRetired(void) {
+    for (zint i = 0; i <= startedCount; i++) {
+        MarkArray *a = workers[i].array;
+
+        while (a->retired != NULL) {
+            MarkArray *retired = a->retired;
+            a->retired = retired->retired;
+            utilFree(retired);
+        }
+    }
+}
+
+/**
+ * Gets the worker for the current thread, making sure its deque is ready
+ * for use.
+ */
+static MarkWorker *currentWorker(void) {
+    MarkWorker *w = thisWorker;
+
+    if (w->array == NULL) {
+        // First use of the mutator thread's deque.
+        w->array = newArray(DAT_MARK_DEQUE_SIZE, NULL);
+    }
+
+    return w;
+}
+
+/**
+ * Marks the given (non-`NULL`) value, pushing it onto the given worker's
+ * deque if it wasn't already marked.
+ */
+static inline void markValue(MarkWorker *w, zvalue value) {
+    // Mark the value, and iterate to mark its class (and then metaclass,
+    // etc.). The loop is needed since classes are not all immortal.
+    for (;;) {
+        zint size = heapMark(value);
+
+        if (size == 0) {
+            break;
+        }
+
+        dequePush(w, value);
+        w->markedCount++;
+        w->markedBytes += size;
+        value = value->cls;
+    }
+}
+
+
+//
+// Module Definitions
+//
+
+// Documented in header.
+void markLayout(zvalue value, const zgcLayout *layout) {
+    MarkWorker *w = currentWorker();
+    char *payload = datPayload(value);
+    zvalue *slots = (zvalue *) payload;
+    uint64_t fields = layout->fields;
+
+    // Prefetch all the fields' referents before marking any of them, so
+    // that the memory fetches can overlap.
+    for (uint64_t f = fields; f != 0; f &= f - 1) {
+        __builtin_prefetch(slots[__builtin_ctzll(f)]);
+    }
+
+    for (uint64_t f = fields; f != 0; f &= f - 1) {
+        zvalue one = slots[__builtin_ctzll(f)];
+        if (one != NULL) {
+            markValue(w, one);
+        }
+    }
+
+    zint refs = layout->elementRefs;
+
+    if (refs == 0) {
+        return;
+    }
+
+    zint count = (layout->elementCount != 0)
+        ? layout->elementCount
+        : *(zint *) (payload + layout->countOffset);
+    zint elementSize = layout->elementSize;
+    char *elems = layout->arrayIndirect
+        ? *(char **) (payload + layout->arrayOffset)
+        : payload + layout->arrayOffset;
+    zint aheadSize = DAT_GC_PREFETCH_DISTANCE * elementSize;
+
+    for (zint i = 0; i < count; i++) {
+        zvalue *at = (zvalue *) (elems + (i * elementSize));
+
+        if ((i + DAT_GC_PREFETCH_DISTANCE) < count) {
+            __builtin_prefetch(*(zvalue *) ((char *) at + aheadSize));
+        }
+
+        for (zint j = 0; j < refs; j++) {
+            zvalue one = at[j];
+            if (one != NULL) {
+                markValue(w, one);
+            }
+        }
+    }
+}
+
+// Documented in header.
+bool markTraceSome(zint budget) {
+    MarkWorker *w = &workers[0];
+
+    for (/*budget*/; budget > 0; budget--) {
+        zvalue value = dequeTake(w);
+
+        if (value == NULL) {
+            return true;
+        }
+
+        callGcMark(value);
+    }
+
+    return !dequeHasWork(w);
+}
+
+// Documented in header.
+zint markTraceAll(zint *markedBytes) {
+    if (threadCount == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (cpus < 1) ? 1 : cpus;
+        if (threadCount > DAT_MAX_MARK_THREADS) {
+            threadCount = DAT_MAX_MARK_THREADS;
+        }
+    }
+
+    if (threadCount == 1) {
+        traceSerial();
+    } else {
+        traceParallel();
+    }
+
+    freeRetired();
+
+    zint result = 0;
+    *markedBytes = 0;
+    for (zint i = 0; i <= startedCount; i++) {
+        result += workers[i].markedCount;
+        *markedBytes += workers[i].markedBytes;
+        workers[i].markedCount = 0;
+        workers[i].markedBytes = 0;
+    }
+
+    return result;
+}
+
+
+//
+// Exported Definitions
+//
+
+// Documented in header.
+void datGcSetMarkThreads(zint count) {
+    if ((count < 0) || (count > DAT_MAX_MARK_THREADS)) {
+        die("Invalid gc mark thread count: %d", count);
+    }
+
+    threadCount = count;
+}
+
+// Documented in header.
+void datMark(zvalue value) {
+    if (value != NULL) {
+        markValue(currentWorker(), value);
+    }
+}
@@ -9,6 +9,90 @@
 #ifndef _DAT_CALL_H_
 #define _DAT_CALL_H_
 
+#include "util.h"
+
+/**
+ * Entry in an inline method cache: a receiver class, along with the
+ * function bound to the call site's method name in that class.
+ */
+typedef struct {
+    /** Class of the receiver. */
+    zvalue cls;
+
+    /** Function that the method resolves to. */
+    zvalue function;
+
+    /**
+     * Method binding epoch of `cls` as of the lookup. The entry is only
+     * valid while the class is still in the same epoch.
+     */
+    zint epoch;
+} zmethodCacheEntry;
+
+/**
+ * Inline method cache for a single call site, that is, for calls to a
+ * particular method name from a particular spot in code. This is meant to be
+ * embedded in the payload of a value (the "owner" of the cache), with the
+ * `entries` typically also part of that payload. The owner's gc layout is
+ * responsible for tracing the entries.
+ */
+typedef struct {
+    /** Number of calls that found their class in the cache. */
+    zint hits;
+
+    /** Number of calls that didn't find their class in the cache. */
+    zint misses;
+
+    /** Number of entries. `0` indicates a site which doesn't cache. */
+    zint size;
+
+    /** The entries, in order of filling. */
+    zmethodCacheEntry *entries;
+} zcallCache;
+
+/**
+ * Totals of inline method cache activity, across all call sites.
+ */
+typedef struct {
+    /** Calls that hit on the first entry of a cache. */
+    zint monomorphicHits;
+
+    /** Calls that hit on an entry other than the first. */
+    zint polymorphicHits;
+
+    /** Calls that missed, filling in an unused or stale entry. */
+    zint misses;
+
+    /** Calls that missed with all entries in use, replacing one. */
+    zint megamorphicMisses;
+} zcallCacheStats;
+
+/**
+ * Position in the call trace, for use with `methTraceReset()`.
+ */
+typedef struct {
+    /** Number of calls in progress. */
+    zint depth;
+
+    /** Top of the giblet stack. */
+    struct UtilStackGiblet *giblet;
+} ztraceMark;
+
+/**
+ * Call trace entry for a call that isn't made by one of the `methCall*()`
+ * functions. See `methTracePush()`.
+ */
+typedef struct {
+    /** Target being called. */
+    zvalue target;
+
+    /** Name of method being called. */
+    zvalue name;
+
+    /** Giblet for the entry. Only used when `DAT_FULL_TRACE` is on. */
+    UtilStackGiblet giblet;
+} ztraceEntry;
+
 /**
  * Calls the method `name` on target `target`, with the given list of
  * `args`. `name` must be a symbol, and `args` must be a list or `NULL` (the
@@ -28,6 +112,56 @@ zvalue methApply(zvalue target, zvalue name, zvalue args);
  */
 zvalue methCall(zvalue target, zvalue name, zarray args);
 
+/**
+ * Like `methCall(target, SYM(call), args)`, for a `target` which is known
+ * to be an instance of class `Builtin`. This skips the method lookup and
+ * invokes the builtin's function directly, while still recording the call in
+ * the call trace.
+ */
+zvalue methCallBuiltin(zvalue target, zarray args);
+
+/**
+ * Gets the totals of inline method cache activity so far.
+ */
+zcallCacheStats methCallCacheStats(void);
+
+/**
+ * Like `methCall()`, but consulting and updating the given inline method
+ * cache, which belongs to the value `owner`. All calls made through a given
+ * cache must use the same `name`.
+ */
+zvalue methCallCached(zvalue owner, zcallCache *cache, zvalue target,
+        zvalue name, zarray args);
+
+/**
+ * Gets the current position in the call trace.
+ */
+ztraceMark methTraceMark(void);
+
+/**
+ * Records a call of `name` on `target` in the call trace, as the innermost
+ * call in progress, using `entry` as storage. This is for callers that make
+ * calls without using the `methCall*()` functions, such as the bytecode
+ * virtual machine. `entry` has to stay put until the call is over, at which
+ * point the caller resets the trace to what it was before the push (see
+ * `methTraceReset()`).
+ */
+void methTracePush(ztraceEntry *entry, zvalue target, zvalue name);
+
+/**
+ * Replaces the innermost call in the call trace with a call of `name` on
+ * `target`. This is used when a call in tail position gets made in place
+ * of the one that made it.
+ */
+void methTraceReplace(zvalue target, zvalue name);
+
+/**
+ * Resets the call trace to the given position, which must have been
+ * obtained from an outer call. This is used when a nonlocal exit skips
+ * over calls without returning from them.
+ */
+void methTraceReset(ztraceMark mark);
+
 /**
  * Function which should never get called. This is used to wrap calls which
  * aren't allowed to return. Should they return, this function gets called
@@ -40,6 +174,13 @@ zvalue methCall(zvalue target, zvalue name, zarray args);
 zvalue mustNotYield(zvalue value)
     __attribute__((noreturn));
 
+/**
+ * Gets all the arguments passed to a `zfunction` (that is, `first` followed
+ * by `rest`) as a single array. `elems` is used as storage for the result
+ * if necessary, and must have room for `rest.size + 1` elements.
+ */
+zarray zarrayFromArgs(zvalue first, zarray rest, zvalue *elems);
+
 
 //
 // Function / method calling macros
@@ -5,6 +5,10 @@
 //
 // Frame (stack references) management
 //
+// The stack is made of a chain of segments, which get added as needed. Only
+// the segment holding the top of the stack is described by the variables
+// below; all the segments before it are always full.
+//
 
 #ifndef _DAT_FRAME_H_
 #define _DAT_FRAME_H_
@@ -14,17 +18,33 @@
 // Private Definitions
 //
 
-/** Base of the stack (builds forward in memory). */
+/** Base of the current stack segment (builds forward in memory). */
 extern zstackPointer frameStackBase;
 
 /** Points at the location for the next `add`. */
 extern zstackPointer frameStackTop;
 
-/** Limit of the stack (highest possible value for `frameStackTop`). */
+/**
+ * Limit of the current stack segment (highest possible value for
+ * `frameStackTop`).
+ */
 extern zstackPointer frameStackLimit;
 
 /** Indicates a fatal error. */
-void datFrameError(const char *message);
+void datFrameError(const char *message)
+    __attribute__((noreturn));
+
+/**
+ * Moves on to the next stack segment, making one if necessary. Called when
+ * the current segment is full.
+ */
+void datFrameGrow(void);
+
+/**
+ * Returns to the given stack pointer, which is in an earlier stack segment
+ * than the current one.
+ */
+void datFrameUnwind(zstackPointer savedStack);
 
 
 //
@@ -43,7 +63,7 @@ inline zvalue datFrameAdd(zvalue value) {
     if (value == NULL) {
         return NULL;
     } else if (frameStackTop == frameStackLimit) {
-        datFrameError("Value stack overflow.");
+        datFrameGrow();
     }
 
     *frameStackTop = value;
@@ -68,11 +88,12 @@ inline zstackPointer datFrameStart(void) {
  * non-immediate return can happen during a nonlocal exit.
  */
 inline void datFrameReturn(zstackPointer savedStack, zvalue returnValue) {
-    if (savedStack > frameStackTop) {
-        datFrameError("Cannot return to deeper frame.");
+    if ((savedStack >= frameStackBase) && (savedStack <= frameStackTop)) {
+        frameStackTop = savedStack;
+    } else {
+        datFrameUnwind(savedStack);
     }
 
-    frameStackTop = savedStack;
     datFrameAdd(returnValue);
 }
 
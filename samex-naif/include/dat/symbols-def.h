@@ -15,6 +15,7 @@
 DEF_SYMBOL(Bool);
 DEF_SYMBOL(Box);
 DEF_SYMBOL(Builtin);
+DEF_SYMBOL(Bytecode);
 DEF_SYMBOL(Cell);
 DEF_SYMBOL(Class);
 DEF_SYMBOL(Closure);
@@ -22,6 +23,7 @@ DEF_SYMBOL(ClosureNode);
 DEF_SYMBOL(Cmp);
 DEF_SYMBOL(Core);
 DEF_SYMBOL(ExecNode);
+DEF_SYMBOL(Frame);
 DEF_SYMBOL(If);
 DEF_SYMBOL(Int);
 DEF_SYMBOL(Jump);
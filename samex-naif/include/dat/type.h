@@ -53,8 +53,11 @@ typedef struct {
 
 /**
  * Prototype for an underlying C function corresponding to an in-model
- * function.
+ * function. The first argument, if any, is passed as `first`, separately
+ * from the `rest` of the arguments; `first` is `NULL` if there are no
+ * arguments at all. For a method call, `first` is the receiver, which means
+ * that methods can be called without having to build a new argument array.
  */
-typedef zvalue (*zfunction)(zvalue thisFunction, zarray args);
+typedef zvalue (*zfunction)(zvalue thisFunction, zvalue first, zarray rest);
 
 #endif
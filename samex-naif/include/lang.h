@@ -33,6 +33,15 @@ zvalue langEval0(zvalue env, zvalue node);
  */
 zvalue langLanguageOf0(zvalue programText);
 
+/**
+ * Optimizes the given simplified expression node, returning an equivalent
+ * node that is cheaper to evaluate. `env` is the environment that the result
+ * is to be evaluated in (as passed to `langEval0()`), or `NULL` if not
+ * known. Variables in `env` are only ever looked at in order to identify
+ * core classes; their values are never substituted into the result.
+ */
+zvalue langOptimize0(zvalue env, zvalue node);
+
 /**
  * Compiles the given expression text into a parse tree form, suitable
  * for passing to `langSimplify0()`. `expression` must either
@@ -55,6 +64,14 @@ zvalue langParseExpression0(zvalue expression);
  */
 zvalue langParseProgram0(zvalue program);
 
+/**
+ * Sets which engine runs closures. When `bytecode` is `true`, each closure
+ * is compiled to bytecode the first time it is called, and run on a
+ * register-based virtual machine. Otherwise (the default), closures are run
+ * by walking their execution trees.
+ */
+void langSetBytecode(bool bytecode);
+
 /**
  * Simplifies the given expression node to a form that is suitable for
  * passing to `langEval0`. `resolveFn` is allowed to be `NULL`.
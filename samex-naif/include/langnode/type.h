@@ -49,14 +49,28 @@ typedef enum {
     NODE_CH_STAR    // For formal argument repetition.
 } znodeType;
 
-/** Mapping from `Symbol` index to corresponding `znodeType`. */
-extern znodeType nodeSymbolMap[DAT_MAX_SYMBOLS];
+/**
+ * Mapping from `Symbol` index to corresponding `znodeType`. Only covers
+ * indices up to the highest one with a mapping; see `nodeSymbolMapSize`.
+ */
+extern znodeType *nodeSymbolMap;
+
+/** Number of elements in `nodeSymbolMap`. */
+extern zint nodeSymbolMapSize;
+
+/**
+ * Gets the evaluation type (enumerated value) of the symbol with the given
+ * index. Returns `0` if the symbol has no corresponding type.
+ */
+inline znodeType nodeIndexType(zint index) {
+    return (index < nodeSymbolMapSize) ? nodeSymbolMap[index] : 0;
+}
 
 /**
  * Gets the evaluation type (enumerated value) of the given record.
  */
 inline znodeType nodeRecType(zvalue record) {
-    return nodeSymbolMap[recNameIndex(record)];
+    return nodeIndexType(recNameIndex(record));
 }
 
 /**
@@ -70,7 +84,7 @@ inline bool nodeRecTypeIs(zvalue record, znodeType type) {
  * Gets the evaluation type (enumerated value) of the given symbol.
  */
 inline znodeType nodeSymbolType(zvalue symbol) {
-    return nodeSymbolMap[symbolIndex(symbol)];
+    return nodeIndexType(symbolIndex(symbol));
 }
 
 #endif
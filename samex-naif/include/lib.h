@@ -19,7 +19,14 @@ SYM_DECL(runCommandLine);
  * for all the core library values and functions. `libraryPath` is an absolute
  * filesystem path which is expected to point at a directory containing all
  * the in-language library implementation files.
+ *
+ * If `imagePath` is non-`NULL`, it names a heap image file (see
+ * `datImageSave()`) of the loaded library. If the image exists and is
+ * up-to-date with respect to the library files (and the runtime), then
+ * the library is loaded from it instead of from `libraryPath`. If not,
+ * the library is loaded from scratch, and then an attempt is made to save
+ * it as a fresh image.
  */
-zvalue libNewEnvironment(const char *libraryPath);
+zvalue libNewEnvironment(const char *libraryPath, const char *imagePath);
 
 #endif
@@ -36,4 +36,17 @@ extern zvalue THE_NULL_BOX;
 /** The sole void instance of class `Result`. */
 extern zvalue THE_VOID_RESULT;
 
+/**
+ * Gets the value of the given box, without going through a method call.
+ * This is only valid for instances of `Cell`, `Promise`, and `Result`, all
+ * of which use the default `fetch()`, which this is equivalent to.
+ */
+zvalue boxFetchDirect(zvalue box);
+
+/**
+ * Stores into the given `Cell`, without going through a method call. This
+ * is equivalent to `Cell.store()`.
+ */
+zvalue cellStoreDirect(zvalue cell, zvalue value);
+
 #endif
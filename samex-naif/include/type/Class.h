@@ -37,6 +37,14 @@ inline void assertHasClass(zvalue value, zvalue cls) {
     }
 }
 
+/**
+ * Sets the gc layout of instances of the given class, to be used instead
+ * of its `gcMark()` method. The layout is inherited by subclasses made
+ * after this call, except those which bind their own `gcMark()`. `layout`
+ * must remain valid for the life of the process.
+ */
+void classSetGcLayout(zvalue cls, const zgcLayout *layout);
+
 /**
  * Returns true iff the classes of the given values (that is, `classOf()` on
  * each) are the same.
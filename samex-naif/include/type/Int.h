@@ -31,6 +31,16 @@ extern zvalue INT_NEG1;
  */
 zvalue intFromZint(zint value);
 
+/**
+ * Calls the method `name` on the int `target` with the given `args`, for the
+ * methods which are pure arithmetic on ints (such as `add` and `neg`).
+ * Unlike calling the method, this never fails: It returns `NULL` if `name`
+ * isn't one of those methods taking `args.size` arguments, if an argument
+ * isn't an int, or if the operation overflows or is otherwise invalid (such
+ * as division by zero).
+ */
+zvalue intTryCall(zvalue target, zvalue name, zarray args);
+
 /**
  * Gets a `zint` equal to the given int value. `intval` must be an
  * int. It is an error if the value is out of range.
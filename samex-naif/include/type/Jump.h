@@ -31,49 +31,68 @@
 extern zvalue CLS_Jump;
 
 /**
- * Constructs and returns a nonlocal jump, which is initially invalid for
- * use. It becomes valid when `jumpArm()` is called.
+ * Return point of nonlocal jumps. These live on the C stack of the function
+ * being jumped out of, and are only valid between `jumpArm()` and
+ * `jumpRetire()`. Any number of `Jump`s can share a single target. This is
+ * defined here so that the exported macros can access it.
  */
-zvalue makeJump(void);
-
-/**
- * Jump function structure. This is defined here so that the exported macros
- * can access it.
- */
-typedef struct {
+typedef struct JumpTarget {
     /** Environment struct for use with `sigsetjmp` et al. */
     sigjmp_buf env;
 
-    /** Whether the function is valid / usable (in scope, dynamically). */
-    bool valid;
+    /** Unique identifier, which is how `Jump`s refer to this target. */
+    zint id;
+
+    /** Next outer target that is armed, if any. */
+    struct JumpTarget *outer;
 
     /** What to return when jumped to. */
     zvalue result;
-} JumpInfo;
+} JumpTarget;
+
+/** Innermost armed jump target, if any. */
+extern JumpTarget *jumpTargetTop;
+
+/**
+ * Constructs and returns a nonlocal jump to the given target, which must be
+ * armed. The jump is valid for use until the target is retired. `voidOk`
+ * indicates whether the jump may be made without a value.
+ */
+zvalue makeJump(JumpTarget *target, bool voidOk);
+
+/**
+ * Gives the given target a new identifier, and makes it the innermost armed
+ * one. This is just the part of `jumpArm()` which doesn't need to be in a
+ * macro.
+ */
+void jumpPush(JumpTarget *target);
 
 /**
- * Sets the return point for the given nonlocal jump.
+ * Sets up the given target as a nonlocal jump point, and makes it the
+ * innermost armed target. It must be retired (with `jumpRetire()`) before
+ * the function using this macro returns normally.
  */
-#define jumpArm(jump) \
+#define jumpArm(target) \
     do { \
-        JumpInfo *info = datPayload((jump)); \
         zstackPointer save = datFrameStart(); \
-        if (sigsetjmp(info->env, 0)) { \
-            zvalue result = info->result; \
+        ztraceMark traceSave = methTraceMark(); \
+        if (sigsetjmp((target)->env, 0)) { \
+            zvalue result = (target)->result; \
+            jumpTargetTop = (target)->outer; \
+            methTraceReset(traceSave); \
             datFrameReturn(save, result); \
             return result; \
         } \
-        info->valid = true; \
+        jumpPush((target)); \
     } while (0)
 
 /**
- * Retires (invalidates) the given nonlocal jump.
+ * Retires (invalidates) the given target, which must be the innermost armed
+ * one. After this, jumps to it are out-of-scope.
  */
-#define jumpRetire(jump) \
+#define jumpRetire(target) \
     do { \
-        JumpInfo *info = datPayload((jump)); \
-        info->valid = false; \
+        jumpTargetTop = (target)->outer; \
     } while (0)
 
-
 #endif
@@ -28,7 +28,8 @@
  * used as either a prototype or a top-of-implementation declaration.
  */
 #define FUN_IMPL_DECL(name) \
-    zvalue FUN_IMPL_NAME(name)(zvalue thisFunction, zarray args)
+    zvalue FUN_IMPL_NAME(name)(zvalue thisFunction, zvalue first, \
+        zarray rest)
 
 
 //
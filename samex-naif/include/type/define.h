@@ -44,15 +44,18 @@
 
 /**
  * Generalized function implemenation declaration, used by the
- * argument-specific ones.
+ * argument-specific ones. Per the `zfunction` calling convention, the
+ * first argument (if any) arrives as `_first`, separate from the `_rest`.
+ * The argument count has already been checked against `minArgs` and
+ * `maxArgs` by the time the function is called.
  */
 #define FUNC_IMPL_MIN_MAX(name, minArgs, maxArgs) \
-    static zvalue name(zvalue, zarray); \
+    static zvalue name(zvalue, zvalue, zarray); \
     static zvalue MAKE_##name(void) { \
         return makeBuiltin(minArgs, maxArgs, name, 0, \
             symbolFromUtf8(-1, #name)); \
     } \
-    static zvalue name(zvalue _function, zarray _args)
+    static zvalue name(zvalue _function, zvalue _first, zarray _rest)
 
 #define FUNC_IMPL_0(name) \
     static zvalue IMPL_##name(void); \
@@ -64,28 +67,29 @@
 #define FUNC_IMPL_1(name, a0) \
     static zvalue IMPL_##name(zvalue); \
     FUNC_IMPL_MIN_MAX(name, 1, 1) { \
-        return IMPL_##name(_args.elems[0]); \
+        return IMPL_##name(_first); \
     } \
     static zvalue IMPL_##name(zvalue a0)
 
 #define FUNC_IMPL_2(name, a0, a1) \
     static zvalue IMPL_##name(zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 2, 2) { \
-        return IMPL_##name(_args.elems[0], _args.elems[1]); \
+        return IMPL_##name(_first, _rest.elems[0]); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1)
 
 #define FUNC_IMPL_3(name, a0, a1, a2) \
     static zvalue IMPL_##name(zvalue, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 3, 3) { \
-        return IMPL_##name(_args.elems[0], _args.elems[1], _args.elems[2]); \
+        return IMPL_##name(_first, _rest.elems[0], _rest.elems[1]); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zvalue a2)
 
 #define FUNC_IMPL_rest(name, aRest) \
     static zvalue IMPL_##name(zarray); \
     FUNC_IMPL_MIN_MAX(name, 0, -1) { \
-        return IMPL_##name(_args); \
+        zvalue _elems[_rest.size + 1]; \
+        return IMPL_##name(zarrayFromArgs(_first, _rest, _elems)); \
     } \
     static zvalue IMPL_##name(zarray aRest)
 
@@ -93,17 +97,15 @@
     static zvalue IMPL_##name(zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 1, 2) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            (_args.size > 1) ? _args.elems[1] : NULL); \
+            _first, \
+            (_rest.size > 0) ? _rest.elems[0] : NULL); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1)
 
 #define FUNC_IMPL_1_rest(name, a0, aRest) \
     static zvalue IMPL_##name(zvalue, zarray); \
     FUNC_IMPL_MIN_MAX(name, 1, -1) { \
-        return IMPL_##name( \
-            _args.elems[0], \
-            (zarray) {_args.size - 1, &_args.elems[1]}); \
+        return IMPL_##name(_first, _rest); \
     } \
     static zvalue IMPL_##name(zvalue a0, zarray aRest)
 
@@ -111,9 +113,9 @@
     static zvalue IMPL_##name(zvalue, zarray, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 2, -1) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            (zarray) {_args.size - 2, &_args.elems[1]}, \
-            _args.elems[_args.size - 1]); \
+            _first, \
+            (zarray) {_rest.size - 1, _rest.elems}, \
+            _rest.elems[_rest.size - 1]); \
     } \
     static zvalue IMPL_##name(zvalue a0, zarray aRest, zvalue a1)
 
@@ -121,10 +123,10 @@
     static zvalue IMPL_##name(zvalue, zarray, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 3, -1) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            (zarray) {_args.size - 3, &_args.elems[1]}, \
-            _args.elems[_args.size - 2], \
-            _args.elems[_args.size - 1]); \
+            _first, \
+            (zarray) {_rest.size - 2, _rest.elems}, \
+            _rest.elems[_rest.size - 2], \
+            _rest.elems[_rest.size - 1]); \
     } \
     static zvalue IMPL_##name(zvalue a0, zarray aRest, zvalue a1, zvalue a2)
 
@@ -132,9 +134,9 @@
     static zvalue IMPL_##name(zvalue, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 2, 3) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            _args.elems[1], \
-            (_args.size > 2) ? _args.elems[2] : NULL); \
+            _first, \
+            _rest.elems[0], \
+            (_rest.size > 1) ? _rest.elems[1] : NULL); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zvalue a2)
 
@@ -142,10 +144,10 @@
     static zvalue IMPL_##name(zvalue, zvalue, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 2, 4) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            _args.elems[1], \
-            (_args.size > 2) ? _args.elems[2] : NULL, \
-            (_args.size > 3) ? _args.elems[3] : NULL); \
+            _first, \
+            _rest.elems[0], \
+            (_rest.size > 1) ? _rest.elems[1] : NULL, \
+            (_rest.size > 2) ? _rest.elems[2] : NULL); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zvalue a2, zvalue a3)
 
@@ -153,9 +155,9 @@
     static zvalue IMPL_##name(zvalue, zvalue, zarray); \
     FUNC_IMPL_MIN_MAX(name, 2, -1) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            _args.elems[1], \
-            (zarray) {_args.size - 2, &_args.elems[2]}); \
+            _first, \
+            _rest.elems[0], \
+            (zarray) {_rest.size - 1, &_rest.elems[1]}); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zarray aRest)
 
@@ -163,10 +165,10 @@
     static zvalue IMPL_##name(zvalue, zvalue, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 3, 4) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            _args.elems[1], \
-            _args.elems[2], \
-            (_args.size > 3) ? _args.elems[3] : NULL); \
+            _first, \
+            _rest.elems[0], \
+            _rest.elems[1], \
+            (_rest.size > 2) ? _rest.elems[2] : NULL); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zvalue a2, zvalue a3)
 
@@ -174,16 +176,15 @@
     static zvalue IMPL_##name(zvalue, zvalue, zvalue, zvalue, zvalue); \
     FUNC_IMPL_MIN_MAX(name, 3, 5) { \
         return IMPL_##name( \
-            _args.elems[0], \
-            _args.elems[1], \
-            _args.elems[2], \
-            (_args.size > 3) ? _args.elems[3] : NULL, \
-            (_args.size > 4) ? _args.elems[4] : NULL); \
+            _first, \
+            _rest.elems[0], \
+            _rest.elems[1], \
+            (_rest.size > 2) ? _rest.elems[2] : NULL, \
+            (_rest.size > 3) ? _rest.elems[3] : NULL); \
     } \
     static zvalue IMPL_##name(zvalue a0, zvalue a1, zvalue a2, zvalue a3, \
             zvalue a4)
 
-
 //
 // Method implementation declarations and associated binder. Each of the
 // `METH_IMPL*` macros expands to a `FUNC_IMPL*` macro with one extra
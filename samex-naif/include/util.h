@@ -54,6 +54,19 @@ typedef struct UtilStackGiblet {
 /** The current top-of-stack of giblets. */
 extern UtilStackGiblet *utilStackTop;
 
+/**
+ * Function which produces stack context kept somewhere other than in
+ * giblets. It gets called with an `emit` function, which it should call
+ * once per line of context, innermost first.
+ */
+typedef void (*ztraceFunction)(void (*emit)(const char *line));
+
+/**
+ * The function to call upon death to produce non-giblet stack context, if
+ * any. This gets called after all giblet context has been reported.
+ */
+extern ztraceFunction utilTraceFunction;
+
 /**
  * Defines a giblet for the current function. Use this at the point a
  * stack trace for the call would be valid.
@@ -78,8 +91,9 @@ extern UtilStackGiblet *utilStackTop;
 /**
  * Dies (aborts the process) with the given message. Arguments are as
  * with `utilFormat()`. If there is any active stack context (more
- * `UTIL_TRACE_START()`s than `UTIL_TRACE_END()`s), then that context is
- * appended to the death report.
+ * `UTIL_TRACE_START()`s than `UTIL_TRACE_END()`s, or whatever is reported
+ * by `utilTraceFunction`), then that context is appended to the death
+ * report.
  */
 void die(const char *format, ...)
     __attribute__((noreturn));
@@ -145,12 +159,6 @@ void *utilAlloc(zint size);
  */
 void utilFree(void *memory);
 
-/**
- * Returns whether this appears to be a pointer to heap-allocated memory
- * (though not necessarily the start of an allocation).
- */
-bool utilIsHeapAllocated(void *memory);
-
 /**
  * Equivalent to `strdup` that uses the memory allocation functions defined
  * by this module.
@@ -234,6 +242,13 @@ char *utilReadLink(const char *path);
 #define utilZero(dest) \
     memset((dest), 0, sizeof(dest))
 
+/**
+ * Hashes the given bytes (FNV-1a, 64 bit), continuing from the given `seed`,
+ * which should be `0` for a fresh hash or the result of a previous call
+ * when hashing data in pieces. The result is never `0`.
+ */
+zint utilHash(zint seed, const void *data, zint size);
+
 /**
  * Guaranteed-stable sort, which is expected to perform particularly well on
  * partially-sorted data. The arguments are just like those to the standard
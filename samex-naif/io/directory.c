@@ -16,7 +16,6 @@
 #include "type/Cmp.h"
 #include "type/Map.h"
 #include "type/String.h"
-#include "type/SymbolTable.h"
 #include "util.h"
 
 
@@ -71,7 +70,7 @@ zvalue ioReadDirectory(zvalue path) {
         // use `lstat()` (via `ioFileType()`).
         zvalue type = ioFileType(cm_cat(pathPrefix, name), false);
 
-        result = cm_cat(result, symtabFromMapping((zmapping) {name, type}));
+        result = cm_cat(result, mapFromMapping((zmapping) {name, type}));
     }
 
     if (closedir(dir) != 0) {
@@ -0,0 +1,584 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// `Bytecode` class, and the virtual machine that runs it
+//
+// Instances are compiled from the bodies of `ClosureNode`s (see
+// `exnoCompile()`), and are an alternative to walking `ExecNode` trees.
+// The machine has a fixed set of registers per closure call. Subexpressions
+// are evaluated into registers in sequence, instead of by recursing on the C
+// stack. Likewise, function calls to closures push the caller's state onto
+// the machine's own stack and carry on in the same loop.
+
+#include "type/Box.h"
+#include "type/String.h"
+#include "type/define.h"
+#include "util.h"
+
+#include "impl.h"
+
+
+//
+// Private Definitions
+//
+
+/**
+ * Payload data for a bytecode instance. The code itself (`codeSize` words of
+ * `int32_t`) immediately follows the constant pool.
+ */
+typedef struct {
+    /** Number of registers needed to run the code. */
+    zint regCount;
+
+    /** Number of words of code. */
+    zint codeSize;
+
+    /** Number of constants. */
+    zint constCount;
+
+    /** Constant pool. */
+    zvalue consts[/*constCount*/];
+} BytecodeInfo;
+
+enum {
+    /** Minimum number of words in a segment of the VM stack. */
+    VM_SEGMENT_MIN = 16 * 1024
+};
+
+/** Segment of the VM stack. See `VmMark`. */
+typedef struct VmSegment {
+    /** Next (deeper) segment, if any has been made. */
+    struct VmSegment *next;
+
+    /** Number of words the segment can hold. */
+    zint size;
+
+    /** The words. */
+    zvalue words[/*size*/];
+} VmSegment;
+
+/**
+ * Call made within a run of the machine, as kept on the VM stack. This holds
+ * the state of the caller to resume once the call returns. It is followed on
+ * the stack by the storage for the callee's frame (if it doesn't go on the
+ * heap), and then by the callee's registers.
+ *
+ * Nothing on the VM stack gets seen by the gc. Everything referred to from
+ * a call's frame and registers is kept alive via the frame stack, which only
+ * gets popped back past the call's `save` once it returns.
+ */
+typedef struct VmCall {
+    /**
+     * Call that made this one, or `NULL` if it was made by the code that
+     * the run started with.
+     */
+    struct VmCall *caller;
+
+    /** Position of the VM stack before this call. */
+    VmMark mark;
+
+    /** Frame stack as of the call. */
+    zstackPointer save;
+
+    /** Call trace as of the call. */
+    ztraceMark traceSave;
+
+    /** Call trace entry for the call. */
+    ztraceEntry traceEntry;
+
+    /**
+     * Whether the result is allowed to be void. This gets cleared by a call
+     * in tail position that doesn't allow it (as with `callChain()`).
+     */
+    bool voidOk;
+
+    /** Caller's constant pool. */
+    zvalue *consts;
+
+    /** Caller's next instruction. */
+    int32_t *pc;
+
+    /** Caller's registers. */
+    zvalue *regs;
+
+    /** Caller's frame. */
+    zvalue frame;
+
+    /** Caller's register to store the result into. */
+    zvalue *result;
+} VmCall;
+
+enum {
+    /** Number of words of the VM stack taken up by a `VmCall`. */
+    VM_CALL_WORDS = (sizeof(VmCall) + sizeof(zvalue) - 1) / sizeof(zvalue)
+};
+
+/** The first segment of the VM stack, if it has been made. */
+static VmSegment *theFirstSegment = NULL;
+
+/** The segment that holds the top of the VM stack. */
+static VmSegment *theSegment = NULL;
+
+/** Top of the VM stack. */
+static zvalue *theTop = NULL;
+
+/** Limit of `theSegment` (highest possible value for `theTop`). */
+static zvalue *theLimit = NULL;
+
+/**
+ * Frees the given VM stack segment and all the ones after it.
+ */
+static void freeSegments(VmSegment *segment) {
+    while (segment != NULL) {
+        VmSegment *next = segment->next;
+        utilFree(segment);
+        segment = next;
+    }
+}
+
+/**
+ * Moves the top of the VM stack on to the start of the next segment, which
+ * is made to hold at least `words` words.
+ */
+static void nextSegment(zint words) {
+    VmSegment **link =
+        (theSegment == NULL) ? &theFirstSegment : &theSegment->next;
+    VmSegment *next = *link;
+
+    if ((next != NULL) && (next->size < words)) {
+        freeSegments(next);
+        next = NULL;
+    }
+
+    if (next == NULL) {
+        zint size = (words > VM_SEGMENT_MIN) ? words : VM_SEGMENT_MIN;
+        next = utilAlloc(sizeof(VmSegment) + (size * sizeof(zvalue)));
+        next->next = NULL;
+        next->size = size;
+        *link = next;
+    }
+
+    theSegment = next;
+    theTop = next->words;
+    theLimit = next->words + next->size;
+}
+
+/**
+ * Allocates the given number of words on the VM stack.
+ */
+static zvalue *vmAlloc(zint words) {
+    if ((theLimit - theTop) < words) {
+        nextSegment(words);
+    }
+
+    zvalue *result = theTop;
+    theTop += words;
+    return result;
+}
+
+/**
+ * Gets a pointer to the info of a bytecode instance.
+ */
+static BytecodeInfo *getInfo(zvalue code) {
+    return datPayload(code);
+}
+
+/**
+ * Gets a pointer to the code of a bytecode instance.
+ */
+static int32_t *getCode(BytecodeInfo *info) {
+    return (int32_t *) &info->consts[info->constCount];
+}
+
+/**
+ * Pushes a function call to `closure` onto the VM stack, with the given
+ * caller `state`. `code` and `frameWords` are per `exnoClosureCode()`. The
+ * call's frame gets made (with `args` bound in it) and stored to `frame`.
+ * The call trace is expected to be as of `state->traceSave`.
+ */
+static VmCall *pushCall(const VmCall *state, zvalue closure, zvalue code,
+        zint frameWords, zarray args, zvalue *frame) {
+    VmMark mark = bcStackMark();
+    VmCall *result = (VmCall *)
+        vmAlloc(VM_CALL_WORDS + frameWords + getInfo(code)->regCount);
+
+    *result = *state;
+    result->mark = mark;
+    methTracePush(&result->traceEntry, closure, SYM(call));
+
+    *frame = exnoClosureEnter(exnoClosureNode(closure),
+        exnoClosureFrame(closure), (zvalue *) result + VM_CALL_WORDS, args);
+    return result;
+}
+
+/**
+ * Pops the given call (the innermost one) off the VM stack, as it returns
+ * `result`. Returns the call, which still holds the caller's state.
+ */
+static VmCall *popCall(VmCall *call, zvalue result) {
+    if ((result == NULL) && !call->voidOk) {
+        die("Invalid use of void expression result.");
+    }
+
+    datFrameReturn(call->save, result);
+    methTraceReset(call->traceSave);
+    bcStackReset(call->mark);
+    *call->result = result;
+
+    return call;
+}
+
+
+//
+// Module Definitions
+//
+
+// Documented in header.
+zint bcConst(BytecodeBuilder *bc, zvalue value) {
+    if (bc->constCount == bc->constCapacity) {
+        zint newCapacity =
+            (bc->constCapacity == 0) ? 16 : bc->constCapacity * 2;
+        zvalue *newConsts = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (bc->consts != NULL) {
+            utilCpy(zvalue, newConsts, bc->consts, bc->constCount);
+            utilFree(bc->consts);
+        }
+
+        bc->consts = newConsts;
+        bc->constCapacity = newCapacity;
+    }
+
+    bc->consts[bc->constCount] = value;
+    bc->constCount++;
+    return bc->constCount - 1;
+}
+
+// Documented in header.
+void bcEmit(BytecodeBuilder *bc, zint word) {
+    if (bc->codeSize == bc->codeCapacity) {
+        zint newCapacity =
+            (bc->codeCapacity == 0) ? 64 : bc->codeCapacity * 2;
+        int32_t *newCode = utilAlloc(newCapacity * sizeof(int32_t));
+
+        if (bc->code != NULL) {
+            utilCpy(int32_t, newCode, bc->code, bc->codeSize);
+            utilFree(bc->code);
+        }
+
+        bc->code = newCode;
+        bc->codeCapacity = newCapacity;
+    }
+
+    if ((word < INT32_MIN) || (word > INT32_MAX)) {
+        die("Bytecode operand out of range: %d", word);
+    }
+
+    bc->code[bc->codeSize] = (int32_t) word;
+    bc->codeSize++;
+}
+
+// Documented in header.
+zvalue bcFinish(BytecodeBuilder *bc) {
+    zvalue result = datAllocValue(CLS_Bytecode,
+        sizeof(BytecodeInfo)
+        + (bc->constCount * sizeof(zvalue))
+        + (bc->codeSize * sizeof(int32_t)));
+    BytecodeInfo *info = getInfo(result);
+
+    info->regCount = bc->regCount;
+    info->codeSize = bc->codeSize;
+    info->constCount = bc->constCount;
+    utilCpy(zvalue, info->consts, bc->consts, bc->constCount);
+    utilCpy(int32_t, getCode(info), bc->code, bc->codeSize);
+
+    utilFree(bc->consts);
+    utilFree(bc->code);
+    *bc = (BytecodeBuilder) {0};
+
+    return result;
+}
+
+// Documented in header.
+void bcNeedRegs(BytecodeBuilder *bc, zint regCount) {
+    if (regCount > bc->regCount) {
+        bc->regCount = regCount;
+    }
+}
+
+// Documented in header.
+zvalue bcRun(zvalue code, zvalue frame, TailCall *tail) {
+    // Note: Order has to match `zopcode`. Opcodes themselves are kept as
+    // small integers (and not label addresses), so that bytecode survives
+    // being saved in a heap image.
+    static void *labels[OP_COUNT] = {
+        &&op_apply,
+        &&op_call,
+        &&op_check,
+        &&op_closure,
+        &&op_def,
+        &&op_defValue,
+        &&op_die,
+        &&op_fetch,
+        &&op_literal,
+        &&op_noYield,
+        &&op_ref,
+        &&op_return,
+        &&op_store,
+        &&op_tailCall,
+        &&op_void
+    };
+
+    BytecodeInfo *info = getInfo(code);
+    zvalue *consts = info->consts;
+    int32_t *pc = getCode(info);
+    zvalue entryRegs[info->regCount];
+    zvalue *regs = entryRegs;
+
+    // Innermost call made within this run, if any (see `VmCall`).
+    VmCall *call = NULL;
+
+    // Values handed to `enter` and `leave` (below).
+    zvalue callee;
+    zint frameWords;
+    zvalue result;
+
+    // Each instruction is dispatched directly from the end of the previous
+    // one. `pc` is left pointing at the operands.
+    #define DISPATCH() do { goto *labels[*pc++]; } while (0)
+
+    DISPATCH();
+
+    op_apply: {
+        zvalue *r = &regs[pc[0]];
+        r[0] = methApply(r[0], r[1], r[2]);
+        pc += 1;
+        DISPATCH();
+    }
+
+    op_call: {
+        zvalue *r = &regs[pc[0]];
+        zvalue node = consts[pc[1]];
+        zint dynName = pc[2];
+        zarray args = {pc[3], &r[1 + dynName]};
+
+        if (!dynName
+                && (classOf(r[0]) == CLS_Closure)
+                && exnoCallsFunction(node)) {
+            callee = exnoClosureCode(exnoClosureNode(r[0]), &frameWords);
+
+            if (callee != NULL) {
+                VmCall state = {
+                    .caller = call,
+                    .save = datFrameStart(),
+                    .traceSave = methTraceMark(),
+                    .voidOk = true,
+                    .consts = consts,
+                    .pc = pc + 4,
+                    .regs = regs,
+                    .frame = frame,
+                    .result = r
+                };
+
+                call = pushCall(&state, r[0], callee, frameWords, args,
+                    &frame);
+                goto enter;
+            }
+        }
+
+        r[0] = exnoCall(node, r[0], dynName ? r[1] : NULL, args);
+        pc += 4;
+        DISPATCH();
+    }
+
+    op_check: {
+        if (regs[pc[0]] == NULL) {
+            die("Invalid use of void expression result.");
+        }
+        pc += 1;
+        DISPATCH();
+    }
+
+    op_closure: {
+        regs[pc[0]] = exnoEvalClosure(consts[pc[1]], frame);
+        pc += 2;
+        DISPATCH();
+    }
+
+    op_def: {
+        zvalue value = regs[pc[0]];
+        zvalue cls = consts[pc[1]];
+        zvalue boxInstance = (value == NULL)
+            ? METH_CALL(cls, new)
+            : METH_CALL(cls, new, value);
+
+        frameDef(frame, pc[2], boxInstance);
+        pc += 3;
+        DISPATCH();
+    }
+
+    op_defValue: {
+        frameDef(frame, pc[1], regs[pc[0]]);
+        pc += 2;
+        DISPATCH();
+    }
+
+    op_die: {
+        die("%s", utf8DupFromString(consts[pc[0]]));
+    }
+
+    op_fetch: {
+        zvalue *r = &regs[pc[0]];
+        r[0] = cm_fetch(r[0]);
+        pc += 1;
+        DISPATCH();
+    }
+
+    op_literal: {
+        regs[pc[0]] = consts[pc[1]];
+        pc += 2;
+        DISPATCH();
+    }
+
+    op_noYield: {
+        mustNotYield(regs[pc[0]]);
+        // `mustNotYield` will `die` before trying to return here.
+    }
+
+    op_ref: {
+        regs[pc[0]] = frameGet(frame, pc[1], pc[2]);
+        pc += 3;
+        DISPATCH();
+    }
+
+    op_return: {
+        result = regs[pc[0]];
+
+        if (call == NULL) {
+            return result;
+        }
+
+        goto leave;
+    }
+
+    op_store: {
+        zvalue *r = &regs[pc[0]];
+        r[0] = cm_store(r[0], r[1]);
+        pc += 1;
+        DISPATCH();
+    }
+
+    op_tailCall: {
+        zvalue *r = &regs[pc[0]];
+        zarray args = {pc[3], &r[1]};
+
+        if (call == NULL) {
+            return exnoTailCall(consts[pc[1]], r[0], args, pc[2], tail);
+        }
+
+        // This is in a call made within this run, so a pending call gets
+        // made in its place here, just as `callChain()` would.
+        TailCall next;
+        next.closure = NULL;
+        result = exnoTailCall(consts[pc[1]], r[0], args, pc[2], &next);
+
+        if (next.closure == NULL) {
+            goto leave;
+        }
+
+        // Of everything the finished call referenced, only the pending
+        // call's closure and arguments need to stay alive.
+        datFrameReturn(call->save, next.closure);
+        for (zint i = 0; i < next.argCount; i++) {
+            datFrameAdd(next.args[i]);
+        }
+
+        call->voidOk = call->voidOk && next.voidOk;
+        args = (zarray) {next.argCount, next.args};
+        callee = exnoClosureCode(exnoClosureNode(next.closure), &frameWords);
+
+        if (callee == NULL) {
+            methTraceReplace(next.closure, SYM(call));
+            result = exnoCallClosure(exnoClosureNode(next.closure),
+                exnoClosureFrame(next.closure), args);
+            goto leave;
+        }
+
+        VmCall state = *call;
+        methTraceReset(state.traceSave);
+        bcStackReset(state.mark);
+        call = pushCall(&state, next.closure, callee, frameWords, args,
+            &frame);
+        goto enter;
+    }
+
+    op_void: {
+        regs[pc[0]] = NULL;
+        pc += 1;
+        DISPATCH();
+    }
+
+    // Starts running `callee`, for the `call` just pushed.
+    enter: {
+        BytecodeInfo *calleeInfo = getInfo(callee);
+        consts = calleeInfo->consts;
+        pc = getCode(calleeInfo);
+        regs = (zvalue *) call + VM_CALL_WORDS + frameWords;
+        DISPATCH();
+    }
+
+    // Returns `result` from `call`, and resumes its caller.
+    leave: {
+        VmCall *done = popCall(call, result);
+        call = done->caller;
+        consts = done->consts;
+        pc = done->pc;
+        regs = done->regs;
+        frame = done->frame;
+        DISPATCH();
+    }
+
+    #undef DISPATCH
+}
+
+// Documented in header.
+VmMark bcStackMark(void) {
+    return (VmMark) {theSegment, theTop};
+}
+
+// Documented in header.
+void bcStackReset(VmMark mark) {
+    theSegment = mark.segment;
+    theTop = mark.top;
+    theLimit = (mark.segment == NULL)
+        ? NULL
+        : mark.segment->words + mark.segment->size;
+}
+
+
+//
+// Class Definition
+//
+
+/** Gc layout of instances of `Bytecode`. */
+static const zgcLayout theGcLayout = {
+    .elementRefs = 1,
+    .elementSize = sizeof(zvalue),
+    .arrayOffset = offsetof(BytecodeInfo, consts),
+    .countOffset = offsetof(BytecodeInfo, constCount)
+};
+
+/** Initializes the module. */
+MOD_INIT(Bytecode) {
+    MOD_USE(cls);
+
+    CLS_Bytecode = makeCoreClass(SYM(Bytecode), CLS_Core,
+        NULL,
+        NULL);
+    classSetGcLayout(CLS_Bytecode, &theGcLayout);
+}
+
+// Documented in header.
+zvalue CLS_Bytecode = NULL;
@@ -19,11 +19,8 @@
  * Cached info about a `closure`.
  */
 typedef struct {
-    /**
-     * Snapshot of the frame that was active at the moment the closure was
-     * constructed. Left uninitialized for cached values.
-     */
-    Frame frame;
+    /** Frame that was active at the moment the closure was constructed. */
+    zvalue frame;
 
     /**
      * `ClosureNode` instance, which represents the fixed definition of the
@@ -45,15 +42,25 @@ static ClosureInfo *getInfo(zvalue closure) {
 //
 
 // Documented in header.
-zvalue exnoBuildClosure(zvalue node, Frame *frame) {
+zvalue exnoBuildClosure(zvalue node, zvalue frame) {
     zvalue result = datAllocValue(CLS_Closure, sizeof(ClosureInfo));
     ClosureInfo *info = getInfo(result);
 
     info->node = node;
-    frameSnap(&info->frame, frame);
+    info->frame = frame;
     return result;
 }
 
+// Documented in header.
+zvalue exnoClosureFrame(zvalue closure) {
+    return getInfo(closure)->frame;
+}
+
+// Documented in header.
+zvalue exnoClosureNode(zvalue closure) {
+    return getInfo(closure)->node;
+}
+
 
 //
 // Class Definition
@@ -62,7 +69,7 @@ zvalue exnoBuildClosure(zvalue node, Frame *frame) {
 // Documented in header.
 METH_IMPL_rest(Closure, call, args) {
     ClosureInfo *info = getInfo(ths);
-    return exnoCallClosure(info->node, &info->frame, ths, args);
+    return exnoCallClosure(info->node, info->frame, args);
 }
 
 // Documented in header.
@@ -70,25 +77,24 @@ METH_IMPL_0(Closure, debugSymbol) {
     return METH_CALL(getInfo(ths)->node, debugSymbol);
 }
 
-// Documented in header.
-METH_IMPL_0(Closure, gcMark) {
-    ClosureInfo *info = getInfo(ths);
-
-    frameMark(&info->frame);
-    datMark(info->node);  // All the other bits are derived from this.
-    return NULL;
-}
+/** Gc layout of instances of `Closure`. */
+static const zgcLayout theGcLayout = {
+    .fields =
+        DAT_GC_FIELD(ClosureInfo, frame) |
+        DAT_GC_FIELD(ClosureInfo, node)
+};
 
 /** Initializes the module. */
 MOD_INIT(Closure) {
     MOD_USE(cls);
+    MOD_USE(Frame);
 
     CLS_Closure = makeCoreClass(SYM(Closure), CLS_Core,
         NULL,
         METH_TABLE(
             METH_BIND(Closure, call),
-            METH_BIND(Closure, debugSymbol),
-            METH_BIND(Closure, gcMark)));
+            METH_BIND(Closure, debugSymbol)));
+    classSetGcLayout(CLS_Closure, &theGcLayout);
 }
 
 // Documented in header.
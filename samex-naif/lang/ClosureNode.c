@@ -15,7 +15,6 @@
 #include "type/Box.h"
 #include "type/Jump.h"
 #include "type/List.h"
-#include "type/SymbolTable.h"
 
 #include "impl.h"
 
@@ -43,6 +42,12 @@ typedef struct {
 
     /** Repetition style. */
     zrepeat repeat;
+
+    /**
+     * Whether the argument's variable needs an actual box (see `Scope`).
+     * Set up by `exnoResolveClosure()`.
+     */
+    bool boxed;
 } zformal;
 
 /**
@@ -59,6 +64,19 @@ typedef struct {
     /** The number of actual names in `formals`, plus one for a `yieldDef`. */
     zint formalsNameCount;
 
+    /**
+     * Number of slots in frames for calls to this closure. Named formals
+     * (and then the `yieldDef`) come first, followed by the variables
+     * defined by `statements`, in order.
+     */
+    zint frameSize;
+
+    /**
+     * `Bytecode` compiled from `statements` and `yield`, if this closure
+     * has been called while the bytecode engine is on. `NULL` otherwise.
+     */
+    zvalue bytecode;
+
     /** `node::name`. */
     zvalue name;
 
@@ -73,8 +91,41 @@ typedef struct {
 
     /** `node::yieldDef`. */
     zvalue yieldDef;
+
+    /** Like `zformal.boxed`, but for the `yieldDef`. */
+    bool yieldDefBoxed;
+
+    /**
+     * Whether the `yieldDef` is ever referred to. If not, there is no way
+     * for a nonlocal exit to be taken. See `Scope.exitUsed`.
+     */
+    bool yieldDefUsed;
+
+    /**
+     * Whether closures built from this node need to keep the frame they
+     * were built in. See `Scope.usesParent`.
+     */
+    bool usesParent;
+
+    /**
+     * Whether frames for calls to this closure need to be on the heap. See
+     * `Scope.frameEscapes`.
+     */
+    bool frameEscapes;
+
+    /**
+     * The sole closure built from this node, if it doesn't `usesParent`
+     * and has been evaluated. `NULL` otherwise.
+     */
+    zvalue shared;
 } ClosureNodeInfo;
 
+/**
+ * Whether closures are run by compiling to bytecode (as opposed to by
+ * walking `ExecNode` trees).
+ */
+static bool useBytecode = false;
+
 /**
  * Gets the info of a record.
  */
@@ -167,12 +218,11 @@ static void convertFormals(ClosureNodeInfo *info, zvalue formalsList) {
 }
 
 /**
- * Creates a variable table for all the formal arguments of the given
- * function.
+ * Binds all the formal arguments of the given function (and its nonlocal
+ * exit, if any) to the first slots of the given frame.
  */
-static zvalue bindArguments(ClosureNodeInfo *info, zvalue exitFunction,
-        zarray args) {
-    zmapping elems[info->formalsNameCount];
+static void bindArguments(ClosureNodeInfo *info, zvalue frame,
+        zvalue exitFunction, zarray args) {
     zformal *formals = info->formals;
     zint formalsSize = info->formalsSize;
     zint elemAt = 0;
@@ -222,8 +272,8 @@ static zvalue bindArguments(ClosureNodeInfo *info, zvalue exitFunction,
         }
 
         if (!ignore) {
-            elems[elemAt].key = name;
-            elems[elemAt].value = cm_new(Result, value);
+            frameDef(frame, elemAt,
+                formals[i].boxed ? cm_new(Result, value) : value);
             elemAt++;
         }
     }
@@ -234,34 +284,190 @@ static zvalue bindArguments(ClosureNodeInfo *info, zvalue exitFunction,
     }
 
     if (exitFunction != NULL) {
-        elems[elemAt].key = info->yieldDef;
-        elems[elemAt].value = cm_new(Result, exitFunction);
-        elemAt++;
+        frameDef(frame, elemAt,
+            info->yieldDefBoxed
+                ? cm_new(Result, exitFunction)
+                : exitFunction);
+    }
+}
+
+/**
+ * Gets the `Bytecode` for the given node, compiling it if this is the first
+ * time it's needed.
+ */
+static zvalue bytecodeOf(zvalue node) {
+    ClosureNodeInfo *info = getInfo(node);
+
+    if (info->bytecode == NULL) {
+        zvalue code = exnoCompile(info->statementsArr, info->yield);
+        datWriteBarrier(node, NULL, code);
+        info->bytecode = code;
     }
 
-    return symtabFromZassoc((zassoc) {elemAt, elems});
+    return info->bytecode;
 }
 
 /**
  * Helper that does the main work of `exnoCallClosure`, including nonlocal
- * exit binding when appropriate.
+ * exit binding when appropriate. A call in tail position is left pending in
+ * `tail` (see `exnoTailCall()`).
  */
-static zvalue callClosureMain(zvalue node, Frame *parentFrame,
-        zvalue parentClosure, zvalue exitFunction, zarray args) {
+static zvalue callClosureMain(zvalue node, zvalue parentFrame,
+        zvalue exitFunction, zarray args, TailCall *tail) {
     ClosureNodeInfo *info = getInfo(node);
 
-    // With the closure's frame as the parent, bind the formals and
-    // nonlocal exit (if present), creating a new execution frame.
+    // With the closure's frame as the parent, create a new execution frame,
+    // and bind the formals and nonlocal exit (if present) in it.
 
-    Frame frame;
-    zvalue argTable = bindArguments(info, exitFunction, args);
-    frameInit(&frame, parentFrame, parentClosure, argTable);
+    // The frame goes on the C stack unless some closure built while running
+    // this one could keep it.
+    zvalue storage[info->frameEscapes ? 1 : frameStackWords(info->frameSize)];
+    zvalue frame = info->frameEscapes
+        ? makeFrame(parentFrame, info->frameSize)
+        : makeStackFrame(storage, parentFrame, info->frameSize);
+
+    bindArguments(info, frame, exitFunction, args);
+
+    if (useBytecode) {
+        return bcRun(bytecodeOf(node), frame, tail);
+    }
 
     // Execute the statements, updating the frame as needed.
-    exnoExecuteStatements(info->statementsArr, &frame);
+    exnoExecuteStatements(info->statementsArr, frame);
 
     // Execute the yield expression, and return the final result.
-    return exnoExecute(info->yield, &frame);
+    return exnoExecuteTail(info->yield, frame, tail);
+}
+
+/**
+ * Helper for the trampolines, which checks the final result of a chain of
+ * tail calls.
+ */
+static zvalue checkResult(zvalue result, bool voidOk) {
+    if ((result == NULL) && !voidOk) {
+        die("Invalid use of void expression result.");
+    }
+
+    return result;
+}
+
+/**
+ * Helper for the trampolines, which sets up to make the call left pending
+ * in `tail`, in place of the one that just finished. Of everything the
+ * finished call referenced, only the pending call's closure and arguments
+ * need to stay alive, so the frame stack is popped back to `save`. The
+ * trace reports the pending call in place of the finished one.
+ */
+static void nextCall(TailCall *tail, zstackPointer save, zvalue *node,
+        zvalue *parentFrame, zarray *args) {
+    datFrameReturn(save, tail->closure);
+    for (zint i = 0; i < tail->argCount; i++) {
+        datFrameAdd(tail->args[i]);
+    }
+
+    methTraceReplace(tail->closure, SYM(call));
+    *node = exnoClosureNode(tail->closure);
+    *parentFrame = exnoClosureFrame(tail->closure);
+    *args = (zarray) {tail->argCount, tail->args};
+}
+
+/**
+ * Helper for `callChainWithExit()`, which runs the chain once `exitTarget`
+ * is armed. This is a separate function so that none of the state which
+ * changes from call to call lives in the frame that `sigsetjmp()` returns
+ * to, where it could get clobbered by a jump.
+ */
+static zvalue callChainArmed(JumpTarget *exitTarget, zvalue node,
+        zvalue parentFrame, zarray args, bool voidOk) {
+    // A jump returns to the frame stack as it is at this point, so it can't
+    // get popped below here.
+    zstackPointer save = datFrameStart();
+    TailCall tail;
+
+    for (;;) {
+        zvalue exitFunction = getInfo(node)->yieldDefUsed
+            ? makeJump(exitTarget, voidOk)
+            : NULL;
+
+        tail.closure = NULL;
+        zvalue result =
+            callClosureMain(node, parentFrame, exitFunction, args, &tail);
+
+        if (tail.closure == NULL) {
+            return checkResult(result, voidOk);
+        }
+
+        voidOk = voidOk && tail.voidOk;
+        nextCall(&tail, save, &node, &parentFrame, &args);
+    }
+}
+
+/**
+ * Helper for `callChainWithExit()`, which arms the jump target that the
+ * exits in the chain share.
+ */
+static zvalue callChainTarget(zvalue node, zvalue parentFrame,
+        zarray args, bool voidOk) {
+    JumpTarget exitTarget;
+    jumpArm(&exitTarget);
+
+    zvalue result =
+        callChainArmed(&exitTarget, node, parentFrame, args, voidOk);
+    jumpRetire(&exitTarget);
+    return result;
+}
+
+/**
+ * Trampoline for a chain of tail calls (see `exnoCallClosure()`), starting
+ * with a call to a closure whose `yieldDef` is used. This is separate from
+ * `callChain()` so that only calls like that need C stack space for a jump
+ * target.
+ *
+ * All the exits in the chain share that target. That's right, because
+ * exiting from any closure in the chain means returning its value from the
+ * chain as a whole. `voidOk` indicates whether the chain so far allows a
+ * void result.
+ */
+static zvalue callChainWithExit(zvalue node, zvalue parentFrame,
+        zarray args, bool voidOk) {
+    // A jump skips over the returns of any calls that the bytecode VM was
+    // in the middle of, so the VM stack gets reset here instead.
+    VmMark mark = bcStackMark();
+    zvalue result = callChainTarget(node, parentFrame, args, voidOk);
+
+    bcStackReset(mark);
+    return result;
+}
+
+/**
+ * Trampoline for a chain of tail calls (see `exnoCallClosure()`), starting
+ * with a call to a closure whose `yieldDef` is unused. If a closure in the
+ * chain turns out to need its `yieldDef`, the rest of the chain is handed
+ * off to `callChainWithExit()`.
+ */
+static zvalue callChain(zvalue node, zvalue parentFrame, zarray args) {
+    zstackPointer save = datFrameStart();
+    TailCall tail;
+    bool voidOk = true;
+
+    for (;;) {
+        if (getInfo(node)->yieldDefUsed) {
+            return callChainWithExit(node, parentFrame, args, voidOk);
+        }
+
+        // Either there is no `yieldDef`, or nothing can call it. In the
+        // latter case, the variable is left unbound, which saves both the
+        // `Jump` allocation and the `sigsetjmp()`.
+        tail.closure = NULL;
+        zvalue result = callClosureMain(node, parentFrame, NULL, args, &tail);
+
+        if (tail.closure == NULL) {
+            return checkResult(result, voidOk);
+        }
+
+        voidOk = voidOk && tail.voidOk;
+        nextCall(&tail, save, &node, &parentFrame, &args);
+    }
 }
 
 
@@ -270,20 +476,130 @@ static zvalue callClosureMain(zvalue node, Frame *parentFrame,
 //
 
 // Documented in header.
-zvalue exnoCallClosure(zvalue node, Frame *parentFrame, zvalue parentClosure,
+zvalue exnoCallClosure(zvalue node, zvalue parentFrame, zarray args) {
+    // This is a trampoline: Each time around, the call just made may have
+    // left a call to another closure pending (see `exnoTailCall()`), which
+    // then gets made in its place, without growing the C stack.
+    return getInfo(node)->yieldDefUsed
+        ? callChainWithExit(node, parentFrame, args, true)
+        : callChain(node, parentFrame, args);
+}
+
+// Documented in header.
+zvalue exnoClosureCode(zvalue node, zint *frameWords) {
+    ClosureNodeInfo *info = getInfo(node);
+
+    if (info->yieldDefUsed) {
+        return NULL;
+    }
+
+    *frameWords = info->frameEscapes ? 0 : frameStackWords(info->frameSize);
+    return bytecodeOf(node);
+}
+
+// Documented in header.
+zvalue exnoClosureEnter(zvalue node, zvalue parentFrame, zvalue *storage,
         zarray args) {
-    if (getInfo(node)->yieldDef == NULL) {
-        return callClosureMain(node, parentFrame, parentClosure, NULL, args);
+    ClosureNodeInfo *info = getInfo(node);
+    zvalue frame = info->frameEscapes
+        ? makeFrame(parentFrame, info->frameSize)
+        : makeStackFrame(storage, parentFrame, info->frameSize);
+
+    bindArguments(info, frame, NULL, args);
+    return frame;
+}
+
+// Documented in header.
+zvalue exnoEvalClosure(zvalue node, zvalue frame) {
+    ClosureNodeInfo *info = getInfo(node);
+
+    if (info->usesParent) {
+        return exnoBuildClosure(node, frame);
+    } else if (info->shared == NULL) {
+        zvalue closure = exnoBuildClosure(node, NULL);
+        datWriteBarrier(node, NULL, closure);
+        info->shared = closure;
     }
 
-    zvalue jump = makeJump();
-    jumpArm(jump);
+    return info->shared;
+}
 
-    zvalue result =
-        callClosureMain(node, parentFrame, parentClosure, jump, args);
-    jumpRetire(jump);
+// Documented in header.
+void exnoResolveClosure(zvalue node, Scope *scope) {
+    ClosureNodeInfo *info = getInfo(node);
+    zarray statements = info->statementsArr;
+    zint maxSize = info->formalsNameCount;
 
-    return result;
+    for (zint i = 0; i < statements.size; i++) {
+        maxSize += exnoDefCount(statements.elems[i]);
+    }
+
+    zvalue names[maxSize];
+    bool boxed[maxSize];
+    Scope inner = {
+        .parent = scope,
+        .capacity = maxSize,
+        .names = names,
+        .boxed = boxed,
+        .exitSlot = -1
+    };
+
+    // The formals and `yieldDef` get the first slots, in the same order
+    // that `bindArguments()` binds them. They all start out unboxed.
+
+    for (zint i = 0; i < info->formalsSize; i++) {
+        zvalue name = info->formals[i].name;
+        if (name != NULL) {
+            names[inner.size] = name;
+            boxed[inner.size] = false;
+            inner.size++;
+        }
+    }
+
+    if (info->yieldDef != NULL) {
+        names[inner.size] = info->yieldDef;
+        boxed[inner.size] = false;
+        inner.exitSlot = inner.size;
+        inner.size++;
+    }
+
+    exnoResolve(info->statements, &inner);
+    exnoResolve(info->yield, &inner);
+
+    // Now that all references have been seen, figure out which of the
+    // formals and `yieldDef` need to be boxed after all.
+
+    zint slot = 0;
+    for (zint i = 0; i < info->formalsSize; i++) {
+        if (info->formals[i].name != NULL) {
+            info->formals[i].boxed = boxed[slot];
+            slot++;
+        }
+    }
+
+    if (info->yieldDef != NULL) {
+        info->yieldDefBoxed = boxed[slot];
+        info->yieldDefUsed = inner.exitUsed;
+    }
+
+    exnoFinishScope(&inner);
+    info->frameSize = inner.size;
+    info->usesParent = inner.usesParent;
+    info->frameEscapes = inner.frameEscapes;
+
+    if (inner.usesParent) {
+        scope->frameEscapes = true;
+    }
+}
+
+
+//
+// Exported Definitions
+//
+
+// Documented in header.
+void langSetBytecode(bool bytecode) {
+    useBytecode = bytecode;
 }
 
 
@@ -325,33 +641,34 @@ METH_IMPL_0(ClosureNode, debugSymbol) {
     return getInfo(ths)->name;
 }
 
-// Documented in header.
-METH_IMPL_0(ClosureNode, gcMark) {
-    ClosureNodeInfo *info = getInfo(ths);
-
-    datMark(info->name);
-    datMark(info->statements);
-    datMark(info->yield);
-    datMark(info->yieldDef);
-
-    for (zint i = 0; i < info->formalsSize; i++) {
-        datMark(info->formals[i].name);
-    }
-
-    return NULL;
-}
+/** Gc layout of instances of `ClosureNode`. */
+static const zgcLayout theGcLayout = {
+    .fields =
+        DAT_GC_FIELD(ClosureNodeInfo, bytecode) |
+        DAT_GC_FIELD(ClosureNodeInfo, name) |
+        DAT_GC_FIELD(ClosureNodeInfo, shared) |
+        DAT_GC_FIELD(ClosureNodeInfo, statements) |
+        DAT_GC_FIELD(ClosureNodeInfo, yield) |
+        DAT_GC_FIELD(ClosureNodeInfo, yieldDef),
+    .pointers = DAT_GC_FIELD(ClosureNodeInfo, statementsArr.elems),
+    .elementRefs = 1,
+    .elementSize = sizeof(zformal),
+    .arrayOffset = offsetof(ClosureNodeInfo, formals),
+    .countOffset = offsetof(ClosureNodeInfo, formalsSize)
+};
 
 /** Initializes the module. */
 MOD_INIT(ClosureNode) {
     MOD_USE(cls);
+    MOD_USE(Bytecode);
     MOD_USE(Jump);
 
     CLS_ClosureNode = makeCoreClass(SYM(ClosureNode), CLS_Core,
         METH_TABLE(
             CMETH_BIND(ClosureNode, new)),
         METH_TABLE(
-            METH_BIND(ClosureNode, debugSymbol),
-            METH_BIND(ClosureNode, gcMark)));
+            METH_BIND(ClosureNode, debugSymbol)));
+    classSetGcLayout(CLS_ClosureNode, &theGcLayout);
 }
 
 // Documented in header.
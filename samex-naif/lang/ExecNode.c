@@ -11,8 +11,11 @@
 #include "langnode.h"
 #include "type/define.h"
 #include "type/Box.h"
+#include "type/Builtin.h"
 #include "type/List.h"
+#include "type/String.h"
 #include "type/SymbolTable.h"
+#include "util.h"
 
 #include "impl.h"
 
@@ -30,8 +33,18 @@
  * for execution.
  */
 typedef struct {
-    /** Type of the node. */
-    znodeType type;
+    /**
+     * Type of the node. This is a `znodeType` to start with, but may get
+     * rewritten to a `zquickType` by `execute()` and back again.
+     */
+    zint type;
+
+    /**
+     * Whether the node has been deoptimized, that is, rewritten from a
+     * `zquickType` back to its original type. Such nodes don't get
+     * specialized again.
+     */
+    bool deoptimized;
 
     /** `node::box`. */
     zvalue box;
@@ -42,7 +55,11 @@ typedef struct {
     /** `node::target`. */
     zvalue target;
 
-    /** `node::value`. Also used to hold `ClosureNode`s. */
+    /**
+     * `node::value`. Also used to hold `ClosureNode`s, the literal
+     * method name of `call` nodes that have one, and the box of `varRef`
+     * nodes that refer to a global (if defined).
+     */
     zvalue value;
 
     /** `node::values`. Also used to hold the `statements` of an `import*`. */
@@ -50,6 +67,33 @@ typedef struct {
 
     /** `zarray` pointer into `values`, when useful. */
     zarray valuesArr;
+
+    /**
+     * For `varRef` nodes, how many frames up from the current one the
+     * variable is defined. Set up by `exnoResolve()`.
+     */
+    zint depth;
+
+    /**
+     * For `varDef` and `varRef` nodes, the frame slot of the variable, or
+     * `-1` for a reference to a global. Set up by `exnoResolve()`.
+     */
+    zint slot;
+
+    /**
+     * For `varDef` nodes, whether the variable is stored unboxed (see
+     * `Scope`). Set up by `exnoFinishScope()`.
+     */
+    bool unboxed;
+
+    /**
+     * Inline method cache, for `call` nodes with a literal method name.
+     * Has `size == 0` for all other nodes.
+     */
+    zcallCache cache;
+
+    /** Storage for the entries of `cache`. */
+    zmethodCacheEntry cacheEntries[/*cache.size*/];
 } ExecNodeInfo;
 
 /**
@@ -59,6 +103,190 @@ static ExecNodeInfo *getInfo(zvalue value) {
     return (ExecNodeInfo *) datPayload(value);
 }
 
+/**
+ * Specialized ("quickened") node types. After a node has been executed,
+ * `execute()` may rewrite its `type` to one of these, based on what it saw
+ * at the time. Each of these checks its assumptions every time it's
+ * executed, and rewrites the node back to its original type (via
+ * `deoptimize()`) when they turn out not to hold. The exception is
+ * `QUICK_fetchUnboxed`, which is set up during resolution and is permanent.
+ */
+typedef enum {
+    /**
+     * `call` of the literal method name `call` on a `Builtin`. Calls the
+     * builtin's function directly, skipping the method lookup.
+     */
+    QUICK_callBuiltin = NODE_CH_STAR + 1,
+
+    /**
+     * `fetch` from a box which uses the default `fetch()` (see
+     * `isSimpleBox()`). Reads the box directly.
+     */
+    QUICK_fetchBox,
+
+    /**
+     * `fetch` of a `varRef` whose box uses the default `fetch()`. Looks up
+     * the variable and reads the box directly.
+     */
+    QUICK_fetchVar,
+
+    /** `fetch` of a `varRef` to an unboxed variable. Reads the value. */
+    QUICK_fetchUnboxed,
+
+    /** `store` into a `Cell`. Writes the box directly. */
+    QUICK_storeCell
+} zquickType;
+
+/**
+ * Gets the original `znodeType` of a node with the given type (which may be
+ * a `zquickType`).
+ */
+static znodeType genericType(zint type) {
+    switch (type) {
+        case QUICK_callBuiltin:  { return NODE_call;  }
+        case QUICK_fetchBox:     { return NODE_fetch; }
+        case QUICK_fetchVar:     { return NODE_fetch; }
+        case QUICK_fetchUnboxed: { return NODE_fetch; }
+        case QUICK_storeCell:    { return NODE_store; }
+        default:                 { return type;       }
+    }
+}
+
+/**
+ * Rewrites a specialized node back to its original type, for good.
+ */
+static void deoptimize(ExecNodeInfo *info) {
+    info->type = genericType(info->type);
+    info->deoptimized = true;
+}
+
+/**
+ * Adds a node to the `users` of the given scope.
+ */
+static void addUser(Scope *scope, zvalue node) {
+    if (scope->userCount == scope->userCapacity) {
+        zint newCapacity =
+            (scope->userCapacity == 0) ? 16 : scope->userCapacity * 2;
+        zvalue *newUsers = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (scope->users != NULL) {
+            utilCpy(zvalue, newUsers, scope->users, scope->userCount);
+            utilFree(scope->users);
+        }
+
+        scope->users = newUsers;
+        scope->userCapacity = newCapacity;
+    }
+
+    scope->users[scope->userCount] = node;
+    scope->userCount++;
+}
+
+/**
+ * Resolves a `varRef` node. If `fetchNode` is non-`NULL`, then the reference
+ * is the target of that `fetch` node, and the variable's box isn't itself
+ * used. Otherwise, the box is used, so the variable can't be unboxed.
+ */
+static void resolveVarRef(ExecNodeInfo *info, Scope *scope,
+        zvalue fetchNode) {
+    info->depth = 0;
+    info->slot = -1;
+
+    // Search from the most recent definition backward, so that a
+    // redefinition shadows the original.
+    for (Scope *s = scope; s != NULL; s = s->parent) {
+        for (zint i = s->size - 1; i >= 0; i--) {
+            if (s->names[i] == info->name) {
+                info->slot = i;
+
+                if (i == s->exitSlot) {
+                    s->exitUsed = true;
+                }
+
+                if (fetchNode == NULL) {
+                    s->boxed[i] = true;
+                } else {
+                    addUser(s, fetchNode);
+                }
+
+                // All the scopes in between need their parent frames.
+                for (Scope *c = scope; c != s; c = c->parent) {
+                    c->usesParent = true;
+                }
+
+                return;
+            }
+        }
+
+        if (s->globals != NULL) {
+            // It's a global. It's not an error for it to be undefined
+            // unless and until the reference actually gets executed.
+            info->value = symtabGet(s->globals, info->name);
+            return;
+        }
+
+        info->depth++;
+    }
+}
+
+/**
+ * Indicates whether the given value is a box whose `fetch()` can be done by
+ * reading it directly. See `boxFetchDirect()`.
+ */
+static bool isSimpleBox(zvalue value) {
+    zvalue cls = classOf(value);
+    return (cls == CLS_Result) || (cls == CLS_Cell) || (cls == CLS_Promise);
+}
+
+/**
+ * Gets the function call node to make as a tail call, if the given closure
+ * `yield` is one, or `NULL` if not. `voidOk` gets set to indicate whether
+ * the call's result is allowed to be void.
+ */
+static zvalue tailCallOf(zvalue yield, bool *voidOk) {
+    ExecNodeInfo *info = getInfo(yield);
+
+    *voidOk = (info->type == NODE_maybe);
+
+    zvalue node = *voidOk ? info->value : yield;
+    ExecNodeInfo *callInfo = getInfo(node);
+
+    if ((genericType(callInfo->type) == NODE_call)
+            && (callInfo->cache.size != 0)  // Literal method name.
+            && (callInfo->value == SYM(call))
+            && (callInfo->valuesArr.size <= LANG_MAX_TAIL_ARGS)) {
+        return node;
+    }
+
+    return NULL;
+}
+
+/**
+ * Gets the message for a reference to the given undefined global.
+ */
+static char *undefinedMessage(zvalue name) {
+    zvalue nameStr = cm_castFrom(CLS_String, name);
+    char *nameChars = cm_debugString(nameStr);
+    char *result = utilFormat("Variable not defined: %s", nameChars);
+
+    utilFree(nameChars);
+    return result;
+}
+
+/**
+ * Gets the box referred to by the given `varRef` node, in the given frame.
+ * Fails with a terminal error if the node refers to an undefined global.
+ */
+static zvalue varRefBox(ExecNodeInfo *info, zvalue frame) {
+    if (info->slot >= 0) {
+        return frameGet(frame, info->depth, info->slot);
+    } else if (info->value == NULL) {
+        die("%s", undefinedMessage(info->name));
+    }
+
+    return info->value;
+}
+
 /**
  * Identifies the variant of execution.
  */
@@ -73,7 +301,7 @@ typedef enum {
  * Executes a single `ExecNode`. `op` identifies the variant. Can return
  * `NULL`.
  */
-static zvalue execute(zvalue node, Frame *frame, zexecOperation op) {
+static zvalue execute(zvalue node, zvalue frame, zexecOperation op) {
     ExecNodeInfo *info = getInfo(node);
 
     zvalue result;
@@ -89,7 +317,9 @@ static zvalue execute(zvalue node, Frame *frame, zexecOperation op) {
 
         case NODE_call: {
             zvalue target = execute(info->target, frame, EX_value);
-            zvalue name = execute(info->name, frame, EX_value);
+            zvalue name = (info->cache.size != 0)
+                ? info->value  // The literal method name.
+                : execute(info->name, frame, EX_value);
             zarray values = info->valuesArr;
 
             // Evaluate each argument expression.
@@ -98,22 +328,92 @@ static zvalue execute(zvalue node, Frame *frame, zexecOperation op) {
                 args[i] = execute(values.elems[i], frame, EX_value);
             }
 
-            result = methCall(target, name, (zarray) {values.size, args});
+            if ((info->cache.size != 0)
+                    && !info->deoptimized
+                    && (name == SYM(call))
+                    && (classOf(target) == CLS_Builtin)) {
+                info->type = QUICK_callBuiltin;
+            }
+
+            result = methCallCached(node, &info->cache, target, name,
+                (zarray) {values.size, args});
+            break;
+        }
+
+        case QUICK_callBuiltin: {
+            zvalue target = execute(info->target, frame, EX_value);
+            zarray values = info->valuesArr;
+            zvalue args[values.size];
+
+            for (zint i = 0; i < values.size; i++) {
+                args[i] = execute(values.elems[i], frame, EX_value);
+            }
+
+            if (classOf(target) == CLS_Builtin) {
+                result = methCallBuiltin(target, (zarray) {values.size, args});
+            } else {
+                deoptimize(info);
+                result = methCallCached(node, &info->cache, target,
+                    info->value, (zarray) {values.size, args});
+            }
+
             break;
         }
 
         case NODE_closure: {
-            result = exnoBuildClosure(info->value, frame);
+            result = exnoEvalClosure(info->value, frame);
             break;
         }
 
         case NODE_fetch: {
             zvalue target = execute(info->target, frame, EX_value);
 
+            if (!info->deoptimized && isSimpleBox(target)) {
+                info->type = (getInfo(info->target)->type == NODE_varRef)
+                    ? QUICK_fetchVar
+                    : QUICK_fetchBox;
+            }
+
             result = cm_fetch(target);
             break;
         }
 
+        case QUICK_fetchBox: {
+            zvalue target = execute(info->target, frame, EX_value);
+
+            if (isSimpleBox(target)) {
+                // As with any value "detached" from a box, this has to be
+                // rooted, since the box could get stored to before the
+                // value is used.
+                result = datFrameAdd(boxFetchDirect(target));
+            } else {
+                deoptimize(info);
+                result = cm_fetch(target);
+            }
+
+            break;
+        }
+
+        case QUICK_fetchUnboxed: {
+            ExecNodeInfo *varInfo = getInfo(info->target);
+
+            result = frameGet(frame, varInfo->depth, varInfo->slot);
+            break;
+        }
+
+        case QUICK_fetchVar: {
+            zvalue target = varRefBox(getInfo(info->target), frame);
+
+            if (isSimpleBox(target)) {
+                result = datFrameAdd(boxFetchDirect(target));
+            } else {
+                deoptimize(info);
+                result = cm_fetch(target);
+            }
+
+            break;
+        }
+
         case NODE_importModule:
         case NODE_importModuleSelection:
         case NODE_importResource: {
@@ -148,26 +448,50 @@ static zvalue execute(zvalue node, Frame *frame, zexecOperation op) {
             zvalue target = execute(info->target, frame, EX_value);
             zvalue value = execute(info->value, frame, EX_maybe);
 
+            if (!info->deoptimized && (classOf(target) == CLS_Cell)) {
+                info->type = QUICK_storeCell;
+            }
+
             result = cm_store(target, value);
             break;
         }
 
+        case QUICK_storeCell: {
+            zvalue target = execute(info->target, frame, EX_value);
+            zvalue value = execute(info->value, frame, EX_maybe);
+
+            if (classOf(target) == CLS_Cell) {
+                result = cellStoreDirect(target, value);
+            } else {
+                deoptimize(info);
+                result = cm_store(target, value);
+            }
+
+            break;
+        }
+
         case NODE_varDef: {
             if (op != EX_statement) {
                 die("Invalid use of `varDef` node.");
             }
 
             zvalue value = execute(info->value, frame, EX_maybe);
+
+            if (info->unboxed) {
+                frameDef(frame, info->slot, value);
+                return NULL;
+            }
+
             zvalue boxInstance = (value == NULL)
                 ? METH_CALL(info->box, new)
                 : METH_CALL(info->box, new, value);
 
-            frameDef(frame, info->name, boxInstance);
+            frameDef(frame, info->slot, boxInstance);
             return NULL;
         }
 
         case NODE_varRef: {
-            result = frameGet(frame, info->name);
+            result = varRefBox(info, frame);
             break;
         }
 
@@ -198,11 +522,275 @@ static zvalue execute(zvalue node, Frame *frame, zexecOperation op) {
     }
 }
 
+/**
+ * Adds a string constant to the pool of the given builder, returning its
+ * index.
+ */
+static zint compileMessage(BytecodeBuilder *bc, const char *message) {
+    return bcConst(bc, stringFromUtf8(-1, message));
+}
+
+/**
+ * Compiles a single `ExecNode`, leaving its result in register `base`. `op`
+ * identifies the variant, just as with `execute()`, and the code produced
+ * behaves the same way (including dying in the same situations). Registers
+ * `base` and up are available for use as temporaries.
+ */
+static void compile(zvalue node, BytecodeBuilder *bc, zexecOperation op,
+        zint base) {
+    ExecNodeInfo *info = getInfo(node);
+    bool nonVoid = false;  // Whether the result is known not to be void.
+
+    bcNeedRegs(bc, base + 1);
+
+    // Nodes may have been specialized by `execute()`, but the compiled
+    // code doesn't care.
+    switch (genericType(info->type)) {
+        case NODE_apply: {
+            compile(info->target, bc, EX_value, base);
+            compile(info->name, bc, EX_value, base + 1);
+            compile(info->values, bc, EX_maybe, base + 2);
+            bcEmit(bc, OP_apply);
+            bcEmit(bc, base);
+            break;
+        }
+
+        case NODE_call: {
+            zarray values = info->valuesArr;
+            zint dynName = (info->cache.size == 0) ? 1 : 0;
+            zint argBase = base + 1 + dynName;
+
+            compile(info->target, bc, EX_value, base);
+
+            if (dynName) {
+                compile(info->name, bc, EX_value, base + 1);
+            }
+
+            for (zint i = 0; i < values.size; i++) {
+                compile(values.elems[i], bc, EX_value, argBase + i);
+            }
+
+            bcNeedRegs(bc, argBase + values.size);
+            bcEmit(bc, OP_call);
+            bcEmit(bc, base);
+            bcEmit(bc, bcConst(bc, node));
+            bcEmit(bc, dynName);
+            bcEmit(bc, values.size);
+            break;
+        }
+
+        case NODE_closure: {
+            bcEmit(bc, OP_closure);
+            bcEmit(bc, base);
+            bcEmit(bc, bcConst(bc, info->value));
+            nonVoid = true;
+            break;
+        }
+
+        case NODE_fetch: {
+            if (info->type == QUICK_fetchUnboxed) {
+                ExecNodeInfo *varInfo = getInfo(info->target);
+                bcEmit(bc, OP_ref);
+                bcEmit(bc, base);
+                bcEmit(bc, varInfo->depth);
+                bcEmit(bc, varInfo->slot);
+                break;
+            }
+
+            compile(info->target, bc, EX_value, base);
+            bcEmit(bc, OP_fetch);
+            bcEmit(bc, base);
+            break;
+        }
+
+        case NODE_importModule:
+        case NODE_importModuleSelection:
+        case NODE_importResource: {
+            if (op != EX_statement) {
+                bcEmit(bc, OP_die);
+                bcEmit(bc,
+                    compileMessage(bc, "Invalid use of `import*` node."));
+                return;
+            }
+
+            zarray statements = info->valuesArr;
+            for (zint i = 0; i < statements.size; i++) {
+                compile(statements.elems[i], bc, EX_statement, base);
+            }
+
+            return;
+        }
+
+        case NODE_literal: {
+            bcEmit(bc, OP_literal);
+            bcEmit(bc, base);
+            bcEmit(bc, bcConst(bc, info->value));
+            nonVoid = true;
+            break;
+        }
+
+        case NODE_maybe: {
+            if (op != EX_maybe) {
+                bcEmit(bc, OP_die);
+                bcEmit(bc, compileMessage(bc, "Invalid use of `maybe` node."));
+                return;
+            }
+
+            // Return directly, to avoid the non-void check.
+            compile(info->value, bc, EX_voidOk, base);
+            return;
+        }
+
+        case NODE_noYield: {
+            compile(info->value, bc, EX_voidOk, base);
+            bcEmit(bc, OP_noYield);
+            bcEmit(bc, base);
+            return;
+        }
+
+        case NODE_store: {
+            compile(info->target, bc, EX_value, base);
+            compile(info->value, bc, EX_maybe, base + 1);
+            bcEmit(bc, OP_store);
+            bcEmit(bc, base);
+            break;
+        }
+
+        case NODE_varDef: {
+            if (op != EX_statement) {
+                bcEmit(bc, OP_die);
+                bcEmit(bc,
+                    compileMessage(bc, "Invalid use of `varDef` node."));
+                return;
+            }
+
+            compile(info->value, bc, EX_maybe, base);
+
+            if (info->unboxed) {
+                bcEmit(bc, OP_defValue);
+                bcEmit(bc, base);
+                bcEmit(bc, info->slot);
+            } else {
+                bcEmit(bc, OP_def);
+                bcEmit(bc, base);
+                bcEmit(bc, bcConst(bc, info->box));
+                bcEmit(bc, info->slot);
+            }
+
+            return;
+        }
+
+        case NODE_varRef: {
+            if (info->slot >= 0) {
+                bcEmit(bc, OP_ref);
+                bcEmit(bc, base);
+                bcEmit(bc, info->depth);
+                bcEmit(bc, info->slot);
+            } else if (info->value != NULL) {
+                bcEmit(bc, OP_literal);
+                bcEmit(bc, base);
+                bcEmit(bc, bcConst(bc, info->value));
+            } else {
+                char *message = undefinedMessage(info->name);
+                bcEmit(bc, OP_die);
+                bcEmit(bc, compileMessage(bc, message));
+                utilFree(message);
+                return;
+            }
+
+            nonVoid = true;
+            break;
+        }
+
+        case NODE_void: {
+            if (op != EX_maybe) {
+                bcEmit(bc, OP_die);
+                bcEmit(bc, compileMessage(bc, "Invalid use of `void` node."));
+                return;
+            }
+
+            bcEmit(bc, OP_void);
+            bcEmit(bc, base);
+            return;
+        }
+
+        default: {
+            die("Invalid type (shouldn't happen): %d", info->type);
+        }
+    }
+
+    // As with `execute()`, some cases above return directly, so as to
+    // properly avoid this check.
+    if (((op == EX_value) || (op == EX_maybe)) && !nonVoid) {
+        bcEmit(bc, OP_check);
+        bcEmit(bc, base);
+    }
+}
+
 
 //
 // Module Definitions
 //
 
+// Documented in header.
+zvalue exnoCall(zvalue node, zvalue target, zvalue name, zarray args) {
+    ExecNodeInfo *info = getInfo(node);
+
+    if (name == NULL) {
+        name = info->value;  // The literal method name.
+    }
+
+    return methCallCached(node, &info->cache, target, name, args);
+}
+
+// Documented in header.
+bool exnoCallsFunction(zvalue node) {
+    ExecNodeInfo *info = getInfo(node);
+
+    return (genericType(info->type) == NODE_call)
+        && (info->cache.size != 0)  // Literal method name.
+        && (info->value == SYM(call));
+}
+
+// Documented in header.
+zvalue exnoCompile(zarray statements, zvalue yield) {
+    BytecodeBuilder bc = {0};
+
+    for (zint i = 0; i < statements.size; i++) {
+        compile(statements.elems[i], &bc, EX_statement, 0);
+    }
+
+    assertHasClass(yield, CLS_ExecNode);
+
+    bool voidOk;
+    zvalue call = tailCallOf(yield, &voidOk);
+
+    if (call == NULL) {
+        compile(yield, &bc, EX_maybe, 0);
+        bcEmit(&bc, OP_return);
+        bcEmit(&bc, 0);
+        return bcFinish(&bc);
+    }
+
+    ExecNodeInfo *info = getInfo(call);
+    zarray values = info->valuesArr;
+
+    compile(info->target, &bc, EX_value, 0);
+
+    for (zint i = 0; i < values.size; i++) {
+        compile(values.elems[i], &bc, EX_value, 1 + i);
+    }
+
+    bcNeedRegs(&bc, 1 + values.size);
+    bcEmit(&bc, OP_tailCall);
+    bcEmit(&bc, 0);
+    bcEmit(&bc, bcConst(&bc, call));
+    bcEmit(&bc, voidOk ? 1 : 0);
+    bcEmit(&bc, values.size);
+
+    return bcFinish(&bc);
+}
+
 // Documented in header.
 void exnoConvert(zvalue *orig) {
     if (*orig == NULL) {
@@ -224,18 +812,209 @@ void exnoConvert(zvalue *orig) {
 }
 
 // Documented in header.
-zvalue exnoExecute(zvalue node, Frame *frame) {
+zint exnoDefCount(zvalue node) {
+    ExecNodeInfo *info = getInfo(node);
+
+    switch (genericType(info->type)) {
+        case NODE_importModule:
+        case NODE_importModuleSelection:
+        case NODE_importResource: {
+            zarray statements = info->valuesArr;
+            zint result = 0;
+
+            for (zint i = 0; i < statements.size; i++) {
+                result += exnoDefCount(statements.elems[i]);
+            }
+
+            return result;
+        }
+
+        case NODE_varDef: {
+            return 1;
+        }
+
+        default: {
+            return 0;
+        }
+    }
+}
+
+// Documented in header.
+zvalue exnoExecute(zvalue node, zvalue frame) {
     assertHasClass(node, CLS_ExecNode);
     return execute(node, frame, EX_maybe);
 }
 
 // Documented in header.
-void exnoExecuteStatements(zarray statements, Frame *frame) {
+zvalue exnoExecuteTail(zvalue node, zvalue frame, TailCall *tail) {
+    assertHasClass(node, CLS_ExecNode);
+
+    bool voidOk;
+    zvalue call = tailCallOf(node, &voidOk);
+
+    if (call == NULL) {
+        return execute(node, frame, EX_maybe);
+    }
+
+    // The arguments are evaluated directly into `tail`, which saves having
+    // an array for them on the C stack. This is safe, because the arguments
+    // of the call being made (which may be in `tail`) have already been
+    // bound.
+    ExecNodeInfo *info = getInfo(call);
+    zvalue target = execute(info->target, frame, EX_value);
+    zarray values = info->valuesArr;
+
+    for (zint i = 0; i < values.size; i++) {
+        tail->args[i] = execute(values.elems[i], frame, EX_value);
+    }
+
+    return exnoTailCall(call, target, (zarray) {values.size, tail->args},
+        voidOk, tail);
+}
+
+// Documented in header.
+void exnoExecuteStatements(zarray statements, zvalue frame) {
     for (zint i = 0; i < statements.size; i++) {
         execute(statements.elems[i], frame, EX_statement);
     }
 }
 
+// Documented in header.
+void exnoFinishScope(Scope *scope) {
+    for (zint i = 0; i < scope->userCount; i++) {
+        ExecNodeInfo *info = getInfo(scope->users[i]);
+
+        if (info->type == NODE_varDef) {
+            info->unboxed = !scope->boxed[info->slot];
+        } else {
+            // It's a `fetch` of a `varRef`.
+            if (!scope->boxed[getInfo(info->target)->slot]) {
+                info->type = QUICK_fetchUnboxed;
+            }
+        }
+    }
+
+    utilFree(scope->users);
+    scope->users = NULL;
+    scope->userCount = 0;
+    scope->userCapacity = 0;
+}
+
+// Documented in header.
+void exnoResolve(zvalue node, Scope *scope) {
+    if (node == NULL) {
+        return;
+    } else if (!typeAccepts(CLS_ExecNode, node)) {
+        // Assumed to be a list.
+        zarray arr = zarrayFromList(node);
+
+        for (zint i = 0; i < arr.size; i++) {
+            exnoResolve(arr.elems[i], scope);
+        }
+
+        return;
+    }
+
+    ExecNodeInfo *info = getInfo(node);
+
+    switch (genericType(info->type)) {
+        case NODE_apply:
+        case NODE_call: {
+            exnoResolve(info->target, scope);
+            exnoResolve(info->name, scope);
+            exnoResolve(info->values, scope);
+            break;
+        }
+
+        case NODE_closure: {
+            exnoResolveClosure(info->value, scope);
+            break;
+        }
+
+        case NODE_importModule:
+        case NODE_importModuleSelection:
+        case NODE_importResource: {
+            exnoResolve(info->values, scope);
+            break;
+        }
+
+        case NODE_maybe:
+        case NODE_noYield: {
+            exnoResolve(info->value, scope);
+            break;
+        }
+
+        case NODE_fetch: {
+            zvalue target = info->target;
+
+            if (genericType(getInfo(target)->type) == NODE_varRef) {
+                resolveVarRef(getInfo(target), scope, node);
+            } else {
+                exnoResolve(target, scope);
+            }
+
+            break;
+        }
+
+        case NODE_store: {
+            exnoResolve(info->target, scope);
+            exnoResolve(info->value, scope);
+            break;
+        }
+
+        case NODE_varDef: {
+            if (scope->size == scope->capacity) {
+                // It's not a statement of a closure.
+                die("Invalid use of `varDef` node.");
+            }
+
+            // The value is resolved first, since the variable isn't in
+            // scope until after it's been defined.
+            exnoResolve(info->value, scope);
+            info->slot = scope->size;
+            scope->names[scope->size] = info->name;
+            scope->boxed[scope->size] = (info->box != CLS_Result);
+            scope->size++;
+            addUser(scope, node);
+            break;
+        }
+
+        case NODE_varRef: {
+            resolveVarRef(info, scope, NULL);
+            break;
+        }
+
+        default: {
+            // Nothing to resolve.
+            break;
+        }
+    }
+}
+
+// Documented in header.
+zvalue exnoTailCall(zvalue node, zvalue target, zarray args, bool voidOk,
+        TailCall *tail) {
+    if (classOf(target) == CLS_Closure) {
+        tail->closure = target;
+        tail->voidOk = voidOk;
+        tail->argCount = args.size;
+
+        if (args.elems != tail->args) {
+            utilCpy(zvalue, tail->args, args.elems, args.size);
+        }
+
+        return NULL;
+    }
+
+    zvalue result = exnoCall(node, target, NULL, args);
+
+    if ((result == NULL) && !voidOk) {
+        die("Invalid use of void expression result.");
+    }
+
+    return result;
+}
+
 // Documented in header.
 zvalue exnoVarDefName(zvalue node) {
     ExecNodeInfo *info = getInfo(node);
@@ -261,11 +1040,13 @@ zvalue langEval0(zvalue env, zvalue node) {
     }
     env = symtabFromZassoc((zassoc) {size, mappings});
 
-    Frame frame;
-    frameInit(&frame, NULL, NULL, env);
+    Scope globalScope = {.globals = env};
 
     exnoConvert(&node);
-    return exnoExecute(node, &frame);
+    exnoResolve(node, &globalScope);
+
+    // Nothing at the top level can be defined in or refer to a frame.
+    return exnoExecute(node, NULL);
 }
 
 
@@ -278,11 +1059,28 @@ zvalue langEval0(zvalue env, zvalue node) {
  */
 CMETH_IMPL_1(ExecNode, new, orig) {
     znodeType type = nodeRecType(orig);
-    zvalue result = datAllocValue(CLS_ExecNode, sizeof(ExecNodeInfo));
+    zint cacheSize = 0;
+
+    if (type == NODE_call) {
+        // Calls with a literal method name get an inline method cache.
+        zvalue name;
+        if (recGet1(orig, SYM(name), &name)
+                && (nodeRecType(name) == NODE_literal)) {
+            cacheSize = DAT_CALL_CACHE_SIZE;
+        }
+    }
+
+    zvalue result = datAllocValue(CLS_ExecNode,
+        sizeof(ExecNodeInfo) + (cacheSize * sizeof(zmethodCacheEntry)));
     ExecNodeInfo *info = getInfo(result);
 
     info->type = type;
 
+    if (cacheSize != 0) {
+        info->cache.size = cacheSize;
+        info->cache.entries = info->cacheEntries;
+    }
+
     switch (type) {
         case NODE_apply:
         case NODE_call: {
@@ -301,6 +1099,10 @@ CMETH_IMPL_1(ExecNode, new, orig) {
                 info->valuesArr = zarrayFromList(info->values);
             }
 
+            if (cacheSize != 0) {
+                info->value = getInfo(info->name)->value;
+            }
+
             break;
         }
 
@@ -400,18 +1202,23 @@ METH_IMPL_0(ExecNode, debugSymbol) {
     return getInfo(ths)->name;
 }
 
-// Documented in header.
-METH_IMPL_0(ExecNode, gcMark) {
-    ExecNodeInfo *info = getInfo(ths);
-
-    datMark(info->box);
-    datMark(info->name);
-    datMark(info->target);
-    datMark(info->value);
-    datMark(info->values);
-
-    return NULL;
-}
+/** Gc layout of instances of `ExecNode`. */
+static const zgcLayout theGcLayout = {
+    .fields =
+        DAT_GC_FIELD(ExecNodeInfo, box) |
+        DAT_GC_FIELD(ExecNodeInfo, name) |
+        DAT_GC_FIELD(ExecNodeInfo, target) |
+        DAT_GC_FIELD(ExecNodeInfo, value) |
+        DAT_GC_FIELD(ExecNodeInfo, values),
+    .pointers =
+        DAT_GC_FIELD(ExecNodeInfo, valuesArr.elems) |
+        DAT_GC_FIELD(ExecNodeInfo, cache.entries),
+    .elementRefs = 2,
+    .elementSize = sizeof(zmethodCacheEntry),
+    .arrayOffset = offsetof(ExecNodeInfo, cache.entries),
+    .arrayIndirect = true,
+    .countOffset = offsetof(ExecNodeInfo, cache.size)
+};
 
 /** Initializes the module. */
 MOD_INIT(ExecNode) {
@@ -423,8 +1230,8 @@ MOD_INIT(ExecNode) {
         METH_TABLE(
             CMETH_BIND(ExecNode, new)),
         METH_TABLE(
-            METH_BIND(ExecNode, debugSymbol),
-            METH_BIND(ExecNode, gcMark)));
+            METH_BIND(ExecNode, debugSymbol)));
+    classSetGcLayout(CLS_ExecNode, &theGcLayout);
 }
 
 // Documented in header.
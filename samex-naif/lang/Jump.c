@@ -20,6 +20,20 @@
 // Private Definitions
 //
 
+/**
+ * Jump function structure.
+ */
+typedef struct {
+    /** Identifier of the target. */
+    zint targetId;
+
+    /** Whether the jump may be made without a value. */
+    bool voidOk;
+} JumpInfo;
+
+/** Last identifier given to a target. */
+static zint lastTargetId = 0;
+
 /**
  * Gets a pointer to the value's info.
  */
@@ -27,17 +41,47 @@ static JumpInfo *getInfo(zvalue jump) {
     return datPayload(jump);
 }
 
+/**
+ * Finds the target of the given jump, if it is still armed. Returns `NULL`
+ * if not.
+ */
+static JumpTarget *findTarget(zvalue jump) {
+    zint id = getInfo(jump)->targetId;
+
+    // Targets are searched innermost first, and the target of a jump
+    // which gets made is usually at or near the top.
+    for (JumpTarget *t = jumpTargetTop; t != NULL; t = t->outer) {
+        if (t->id == id) {
+            return t;
+        }
+    }
+
+    return NULL;
+}
+
 
 //
 // Exported Definitions
 //
 
 // Documented in header.
-zvalue makeJump(void) {
+JumpTarget *jumpTargetTop = NULL;
+
+// Documented in header.
+void jumpPush(JumpTarget *target) {
+    lastTargetId++;
+    target->id = lastTargetId;
+    target->outer = jumpTargetTop;
+    jumpTargetTop = target;
+}
+
+// Documented in header.
+zvalue makeJump(JumpTarget *target, bool voidOk) {
     zvalue result = datAllocValue(CLS_Jump, sizeof(JumpInfo));
     JumpInfo *info = getInfo(result);
 
-    info->valid = false;
+    info->targetId = target->id;
+    info->voidOk = voidOk;
     return result;
 }
 
@@ -49,25 +93,35 @@ zvalue makeJump(void) {
 // Documented in spec.
 METH_IMPL_rest(Jump, call, args) {
     JumpInfo *info = getInfo(ths);
+    JumpTarget *target = findTarget(ths);
 
-    if (!info->valid) {
+    if (target == NULL) {
         die("Out-of-scope nonlocal jump.");
     }
 
+    zvalue result;
+
     switch (args.size) {
-        case 0:  { info->result = NULL;          break;              }
-        case 1:  { info->result = args.elems[0]; break;              }
+        case 0:  { result = NULL;          break;                    }
+        case 1:  { result = args.elems[0]; break;                    }
         default: { die("Invalid argument count for nonlocal jump."); }
     }
 
-    info->valid = false;
-    siglongjmp(info->env, 1);
+    if ((result == NULL) && !info->voidOk) {
+        die("Invalid use of void expression result.");
+    }
+
+    // Note: Nothing allocates between here and the return in `jumpArm()`,
+    // which is where `result` gets re-rooted.
+    target->result = result;
+    siglongjmp(target->env, 1);
 }
 
 // Documented in spec.
 METH_IMPL_0(Jump, debugString) {
-    JumpInfo *info = getInfo(ths);
-    zvalue validStr = info->valid ? EMPTY_STRING : stringFromUtf8(-1, "in");
+    zvalue validStr = (findTarget(ths) != NULL)
+        ? EMPTY_STRING
+        : stringFromUtf8(-1, "in");
 
     return cm_cat(
         stringFromUtf8(-1, "@<Jump "),
@@ -75,14 +129,6 @@ METH_IMPL_0(Jump, debugString) {
         stringFromUtf8(-1, "valid>"));
 }
 
-// Documented in header.
-METH_IMPL_0(Jump, gcMark) {
-    JumpInfo *info = getInfo(ths);
-
-    datMark(info->result);
-    return NULL;
-}
-
 /** Initializes the module. */
 MOD_INIT(Jump) {
     MOD_USE(Value);
@@ -91,8 +137,7 @@ MOD_INIT(Jump) {
         NULL,
         METH_TABLE(
             METH_BIND(Jump, call),
-            METH_BIND(Jump, debugString),
-            METH_BIND(Jump, gcMark)));
+            METH_BIND(Jump, debugString)));
 }
 
 // Documented in header.
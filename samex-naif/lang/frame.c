@@ -6,59 +6,138 @@
 // Execution frames
 //
 
-#include "type/Box.h"
-#include "type/String.h"
-#include "type/Symbol.h"
-#include "type/SymbolTable.h"
-#include "util.h"
+#include "type/define.h"
 
 #include "impl.h"
 
 
+//
+// Private Definitions
+//
+
+/**
+ * Payload data for a frame.
+ */
+typedef struct {
+    /**
+     * Parent frame, that is, the frame of the closure's definition. `NULL`
+     * if the closure doesn't refer to any of its enclosing closures'
+     * variables.
+     */
+    zvalue parentFrame;
+
+    /**
+     * Whether the frame lives on the C stack or the VM stack (see
+     * `makeStackFrame()`), in which case it isn't seen by the gc. What its
+     * slots refer to is kept alive via the frame stack instead (see
+     * `frameDef()`).
+     */
+    bool onStack;
+
+    /** Number of slots. */
+    zint size;
+
+    /** Variables defined in this frame, as boxes indexed by slot. */
+    zvalue slots[/*size*/];
+} FrameInfo;
+
+/**
+ * Gets a pointer to the info of a frame.
+ */
+static FrameInfo *getInfo(zvalue frame) {
+    return datPayload(frame);
+}
+
+
 //
 // Module Definitions
 //
 
 // Documented in header.
-void frameInit(Frame *frame, Frame *parentFrame, zvalue parentClosure,
-        zvalue vars) {
-    if ((parentFrame != NULL) && !parentFrame->onHeap) {
-        die("Stack-allocated `parentFrame`.");
+void frameDef(zvalue frame, zint slot, zvalue box) {
+    FrameInfo *info = getInfo(frame);
+
+    if (info->onStack) {
+        // The gc never looks at a stack frame, so the value has to be
+        // rooted some other way. The frame stack only gets popped back past
+        // this point once the call that made the frame is over, which is
+        // also when the frame goes away.
+        datFrameAdd(box);
+    } else {
+        datWriteBarrier(frame, NULL, box);
     }
 
-    frame->parentFrame = parentFrame;
-    frame->parentClosure = parentClosure;
-    frame->vars = vars;
-    frame->onHeap = false;
+    info->slots[slot] = box;
 }
 
 // Documented in header.
-void frameMark(Frame *frame) {
-    datMark(frame->vars);
-    datMark(frame->parentClosure);  // This will mark `parentFrame`.
+zvalue frameGet(zvalue frame, zint depth, zint slot) {
+    for (zint i = 0; i < depth; i++) {
+        frame = getInfo(frame)->parentFrame;
+    }
+
+    return getInfo(frame)->slots[slot];
 }
 
 // Documented in header.
-void frameDef(Frame *frame, zvalue name, zvalue box) {
-    frame->vars = symtabCatMapping(frame->vars, (zmapping) {name, box});
+zint frameStackWords(zint size) {
+    zint bytes =
+        DAT_STACK_VALUE_SIZE(sizeof(FrameInfo) + (size * sizeof(zvalue)));
+
+    return (bytes + sizeof(zvalue) - 1) / sizeof(zvalue);
 }
 
 // Documented in header.
-zvalue frameGet(Frame *frame, zvalue name) {
-    for (/*frame*/; frame != NULL; frame = frame->parentFrame) {
-        zvalue result = symtabGet(frame->vars, name);
+zvalue makeFrame(zvalue parentFrame, zint size) {
+    zvalue result =
+        datAllocValue(CLS_Frame, sizeof(FrameInfo) + (size * sizeof(zvalue)));
+    FrameInfo *info = getInfo(result);
 
-        if (result != NULL) {
-            return result;
-        }
-    }
+    info->parentFrame = parentFrame;
+    info->size = size;
 
-    zvalue nameStr = cm_castFrom(CLS_String, name);
-    die("Variable not defined: %s", cm_debugString(nameStr));
+    return result;
 }
 
 // Documented in header.
-void frameSnap(Frame *target, Frame *source) {
-    *target = *source;
-    target->onHeap = true;
+zvalue makeStackFrame(zvalue *storage, zvalue parentFrame, zint size) {
+    zvalue result = datInitStackValue(storage, CLS_Frame);
+    FrameInfo *info = getInfo(result);
+
+    info->parentFrame = parentFrame;
+    info->onStack = true;
+    info->size = size;
+
+    for (zint i = 0; i < size; i++) {
+        info->slots[i] = NULL;
+    }
+
+    return result;
+}
+
+
+//
+// Class Definition
+//
+
+/** Gc layout of instances of `Frame`. */
+static const zgcLayout theGcLayout = {
+    .fields = DAT_GC_FIELD(FrameInfo, parentFrame),
+    .elementRefs = 1,
+    .elementSize = sizeof(zvalue),
+    .arrayOffset = offsetof(FrameInfo, slots),
+    .countOffset = offsetof(FrameInfo, size)
+};
+
+/** Initializes the module. */
+MOD_INIT(Frame) {
+    MOD_USE(cls);
+
+    CLS_Frame = makeCoreClass(SYM(Frame), CLS_Core,
+        NULL,
+        NULL);
+    classSetGcLayout(CLS_Frame, &theGcLayout);
 }
+
+// Documented in header.
+zvalue CLS_Frame = NULL;
@@ -10,6 +10,7 @@
 #define _IMPL_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "lang.h"
 #include "langnode.h"
@@ -23,6 +24,12 @@ enum {
     /** Maximum number of formal arguments to a function. */
     LANG_MAX_FORMALS = 20,
 
+    /**
+     * Maximum number of arguments to a call made in tail position. Calls
+     * with more arguments than this are made normally.
+     */
+    LANG_MAX_TAIL_ARGS = 8,
+
     /**
      * Maximum number of characters in a tokenized string constant,
      * identifier, or directive.
@@ -37,23 +44,221 @@ enum {
 };
 
 /**
- * Active execution frame. These are passed around during evaluation
- * as code executes, and can become referenced by closures that are
- * released "in the wild."
+ * Lexical scope, used when resolving variable references. These only exist
+ * (on the C stack) while a tree is being resolved. Each one corresponds to a
+ * closure, and defined names are assigned slots in the order they're added.
+ *
+ * Variables whose box never gets referenced as such (only ever fetched
+ * from) and which are immutable (`Result` boxes) are stored in their frame
+ * slots "unboxed," that is, as their values per se. Whether that's possible
+ * isn't known until the whole closure has been resolved, so nodes whose
+ * form depends on it are collected in `users` and fixed up at the end, by
+ * `exnoFinishScope()`.
+ */
+typedef struct Scope {
+    /**
+     * Enclosing scope. `NULL` for the outermost scope, which is the one that
+     * holds the global variables. That scope never has any slots.
+     */
+    struct Scope *parent;
+
+    /**
+     * Global variables, as a table from names to boxes. Only non-`NULL` for
+     * the outermost scope.
+     */
+    zvalue globals;
+
+    /** Number of names defined so far. */
+    zint size;
+
+    /** Maximum number of names that can be defined. */
+    zint capacity;
+
+    /** Names defined in this scope, indexed by slot. */
+    zvalue *names;
+
+    /** Whether each variable needs an actual box, indexed by slot. */
+    bool *boxed;
+
+    /**
+     * Nodes which refer to variables in this scope and need fixing up once
+     * `boxed` is final.
+     */
+    zvalue *users;
+
+    /** Number of elements in `users`. */
+    zint userCount;
+
+    /** Allocated size of `users`. */
+    zint userCapacity;
+
+    /**
+     * Whether any code in this scope (including in nested closures) refers
+     * to variables of enclosing closures, which means that closures for this
+     * scope need to keep the frame they were built in.
+     */
+    bool usesParent;
+
+    /**
+     * Whether any closure built directly in this scope needs to keep this
+     * scope's frame (see `usesParent`), which means that the frame can't
+     * live on a stack.
+     */
+    bool frameEscapes;
+
+    /** Slot of the closure's nonlocal exit (`yieldDef`), or `-1` if none. */
+    zint exitSlot;
+
+    /**
+     * Whether the nonlocal exit is referred to at all. If not, calls don't
+     * need to set up a `Jump`.
+     */
+    bool exitUsed;
+} Scope;
+
+/**
+ * Bytecode operations. Each instruction is an opcode followed by a fixed
+ * number of operands (all `int32_t`), as listed here. `base` is a register
+ * number; operations that take more than one input read them from
+ * consecutive registers starting at `base`, and they all leave their result
+ * (if any) in `base`. `k` is an index into the constant pool.
+ */
+typedef enum {
+    /** `base`: `methApply()` on `target, name, values`. */
+    OP_apply,
+
+    /**
+     * `base k dynName argc`: Method call, with `consts[k]` being the
+     * `call` node (for its inline cache). Inputs are `target`, then `name`
+     * if `dynName` is `1`, then `argc` arguments.
+     */
+    OP_call,
+
+    /** `base`: Dies if the register is void. */
+    OP_check,
+
+    /**
+     * `base k`: Evaluates the `ClosureNode` `consts[k]`, per
+     * `exnoEvalClosure()`.
+     */
+    OP_closure,
+
+    /**
+     * `base k slot`: Defines a variable in `slot` of the current frame,
+     * with box class `consts[k]` and the (possibly void) value in `base`.
+     */
+    OP_def,
+
+    /**
+     * `base slot`: Defines an unboxed variable in `slot` of the current
+     * frame, with the (possibly void) value in `base`.
+     */
+    OP_defValue,
+
+    /** `k`: Dies, with the string `consts[k]` as the message. */
+    OP_die,
+
+    /** `base`: Fetches from the register's value. */
+    OP_fetch,
+
+    /** `base k`: Loads the constant `consts[k]`. */
+    OP_literal,
+
+    /** `base`: `mustNotYield()` on the register's value. */
+    OP_noYield,
+
+    /**
+     * `base depth slot`: Loads a variable's box (or value, if unboxed), per
+     * `frameGet()`.
+     */
+    OP_ref,
+
+    /** `base`: Returns the (possibly void) register's value. */
+    OP_return,
+
+    /** `base`: Stores `value` into `target`. */
+    OP_store,
+
+    /**
+     * `base k voidOk argc`: Function call (method `call`) in tail position,
+     * with `consts[k]` being the `call` node. Inputs are the function, then
+     * `argc` arguments. Unless the function is a closure, this makes the
+     * call and returns its result, which must not be void unless `voidOk`
+     * is `1`. See `exnoTailCall()`.
+     */
+    OP_tailCall,
+
+    /** `base`: Loads void. */
+    OP_void,
+
+    /** Not an opcode. Number of opcodes. */
+    OP_COUNT
+} zopcode;
+
+/**
+ * Builder of bytecode, used while compiling a closure. This only exists (on
+ * the C stack) during compilation. The constants need not be otherwise
+ * protected from gc, in that they're all reachable from the node being
+ * compiled or are on the frame stack of the caller.
+ */
+typedef struct {
+    /** Instructions emitted so far. */
+    int32_t *code;
+
+    /** Number of words in `code`. */
+    zint codeSize;
+
+    /** Allocated size of `code`. */
+    zint codeCapacity;
+
+    /** Constant pool. */
+    zvalue *consts;
+
+    /** Number of elements in `consts`. */
+    zint constCount;
+
+    /** Allocated size of `consts`. */
+    zint constCapacity;
+
+    /** Number of registers needed by the code. */
+    zint regCount;
+} BytecodeBuilder;
+
+/**
+ * Closure call made in tail position, which is pending. These only exist
+ * (on the C stack) in `exnoCallClosure()` and `bcRun()`, which make the
+ * call after the caller's frame has been torn down. That way, a chain of
+ * tail calls runs in constant space.
  */
-typedef struct Frame {
-    /** Parent closure value. May be `NULL`. */
-    zvalue parentClosure;
+typedef struct {
+    /** Closure to call. `NULL` if there is no pending call. */
+    zvalue closure;
+
+    /** Whether the call's result is allowed to be void. */
+    bool voidOk;
+
+    /** Number of arguments. */
+    zint argCount;
+
+    /** Arguments. */
+    zvalue args[LANG_MAX_TAIL_ARGS];
+} TailCall;
 
-    /** Parent frame. May be `NULL`. */
-    struct Frame *parentFrame;
+/**
+ * Position on the stack where the bytecode VM keeps the state of the calls
+ * it makes without recursing (see `bcRun()`). The stack is in segments, which
+ * never move once made.
+ */
+typedef struct {
+    /** Segment holding the top of the stack. `NULL` before first use. */
+    struct VmSegment *segment;
 
-    /** Variables defined in this frame, as a table from names to values. */
-    zvalue vars;
+    /** Top of the stack. */
+    zvalue *top;
+} VmMark;
 
-    /** Is this frame on the heap? Used for validation/asserts. */
-    bool onHeap;
-} Frame;
+/** Type for compiled closure code. */
+extern zvalue CLS_Bytecode;
 
 /** Type for closure functions. */
 extern zvalue CLS_Closure;
@@ -65,22 +270,121 @@ extern zvalue CLS_ClosureNode;
 extern zvalue CLS_ExecNode;
 
 /**
- * Executes a translated `closure` node, which means that a closure is to be
- * constructed. This takes a `ClosureNode` (not an `ExecNode`) and returns a
- * `Closure` instance.
+ * Type for execution frames. These are passed around during evaluation as
+ * code executes, and can become referenced by closures that are released
+ * "in the wild."
+ */
+extern zvalue CLS_Frame;
+
+/**
+ * Adds a constant to the pool of the given builder, returning its index.
+ */
+zint bcConst(BytecodeBuilder *bc, zvalue value);
+
+/**
+ * Appends an instruction word to the given builder.
+ */
+void bcEmit(BytecodeBuilder *bc, zint word);
+
+/**
+ * Finishes building, returning a `Bytecode` instance. This frees the
+ * builder's storage.
+ */
+zvalue bcFinish(BytecodeBuilder *bc);
+
+/**
+ * Notes that the code being built uses registers up through (but not
+ * including) `regCount`.
+ */
+void bcNeedRegs(BytecodeBuilder *bc, zint regCount);
+
+/**
+ * Runs the given `Bytecode` on the given frame, returning the (possibly
+ * void) result. `tail` is where a call in tail position gets left pending
+ * (see `exnoTailCall()`).
+ *
+ * Function calls to closures are made within the same run, with their state
+ * kept on the VM stack instead of the C stack, except for calls to closures
+ * whose nonlocal exit might get used (see `exnoClosureCode()`).
+ */
+zvalue bcRun(zvalue code, zvalue frame, TailCall *tail);
+
+/**
+ * Gets the current position on the VM stack (see `VmMark`).
+ */
+VmMark bcStackMark(void);
+
+/**
+ * Resets the VM stack to the given position, which must have been obtained
+ * before any of the VM calls still on the stack were made. This is used when
+ * a nonlocal exit skips over calls without returning from them.
+ */
+void bcStackReset(VmMark mark);
+
+/**
+ * Constructs a new closure from the given `ClosureNode` and defining
+ * `frame`. Returns a `Closure` instance.
  */
-zvalue exnoBuildClosure(zvalue node, Frame *frame);
+zvalue exnoBuildClosure(zvalue node, zvalue frame);
+
+/**
+ * Performs the method call of the given converted `call` node, using the
+ * node's inline cache. `name` is `NULL` if the node has a literal method
+ * name.
+ */
+zvalue exnoCall(zvalue node, zvalue target, zvalue name, zarray args);
 
 /**
  * Calls a closure, using the given `node` to drive argument binding and
  * execution. This is where `Closure.call()` bottoms out to do most of its
  * work. `parentFrame` is the execution frame that was active at the time the
- * closure was constructed. `parentClosure` is the object that holds
- * `parentFrame`. `args` are the arguments being passed to this call.
+ * closure was constructed. `args` are the arguments being passed to this
+ * call.
+ */
+zvalue exnoCallClosure(zvalue node, zvalue parentFrame, zarray args);
+
+/**
+ * Indicates whether the given converted `call` node is a function call, that
+ * is, a call with the literal method name `call`.
+ */
+bool exnoCallsFunction(zvalue node);
+
+/**
+ * Gets what's needed to call a closure with the given `ClosureNode` from
+ * within `bcRun()`, without a nested run. Returns the node's `Bytecode`
+ * (compiling it if need be), and stores to `frameWords` the number of words
+ * of storage for the call's frame (`0` if the frame goes on the heap). Returns
+ * `NULL` if the closure's nonlocal exit might get used, in which case the
+ * call has to go through `exnoCallClosure()`, for its jump target.
  */
-zvalue exnoCallClosure(zvalue node, Frame *parentFrame, zvalue parentClosure,
+zvalue exnoClosureCode(zvalue node, zint *frameWords);
+
+/**
+ * Makes the frame for a call set up by `exnoClosureCode()`, binding `args`
+ * in it. The frame is made in `storage` unless it goes on the heap. Returns
+ * the frame.
+ */
+zvalue exnoClosureEnter(zvalue node, zvalue parentFrame, zvalue *storage,
         zarray args);
 
+/**
+ * Gets the defining frame of the given `Closure` instance.
+ */
+zvalue exnoClosureFrame(zvalue closure);
+
+/**
+ * Gets the `ClosureNode` of the given `Closure` instance.
+ */
+zvalue exnoClosureNode(zvalue closure);
+
+/**
+ * Compiles a closure body, that is, the given `zarray` of statements
+ * followed by the `yield` expression, returning a `Bytecode` instance.
+ * The tree must already have been resolved. A function call which is the
+ * `yield` is compiled as a tail call.
+ */
+zvalue exnoCompile(zarray statements, zvalue yield);
+
 /**
  * Converts an `expression` node or list (per se) of same. This converts
  * nodes into instances of `ExecNode`, and stores a reference to the
@@ -89,18 +393,69 @@ zvalue exnoCallClosure(zvalue node, Frame *parentFrame, zvalue parentClosure,
  */
 void exnoConvert(zvalue *orig);
 
+/**
+ * Gets the number of variables defined by the given translated statement,
+ * that is, the number of slots it needs in its frame.
+ */
+zint exnoDefCount(zvalue node);
+
+/**
+ * Executes a translated `closure` node, which means that a closure is to be
+ * constructed. This takes a `ClosureNode` (not an `ExecNode`) and returns a
+ * `Closure` instance. Closures that don't refer to any variables of their
+ * enclosing closures get built just once and shared.
+ */
+zvalue exnoEvalClosure(zvalue node, zvalue frame);
+
 /**
  * Executes a translated `expression` node, in particular an instance of
  * `ExecNode`. This allows for converted `maybe` and `void` nodes.
  */
-zvalue exnoExecute(zvalue node, Frame *frame);
+zvalue exnoExecute(zvalue node, zvalue frame);
+
+/**
+ * Like `exnoExecute()`, for the `yield` of a closure. If it is a call to a
+ * closure, the call is left pending in `tail` instead of being made, and
+ * this returns `NULL`. See `exnoTailCall()`.
+ */
+zvalue exnoExecuteTail(zvalue node, zvalue frame, TailCall *tail);
 
 /**
  * Executes a `zarray` of translated `expression` nodes, treating them as
  * statements. (E.g., it allows variable definitions and doesn't care if they
  * yield void.)
  */
-void exnoExecuteStatements(zarray statements, Frame *frame);
+void exnoExecuteStatements(zarray statements, zvalue frame);
+
+/**
+ * Finishes resolution of the given scope, once its closure has been
+ * resolved, fixing up the recorded nodes to match its final `boxed` flags.
+ * This frees `scope->users`.
+ */
+void exnoFinishScope(Scope *scope);
+
+/**
+ * Resolves all the variable references and definitions in the given
+ * translated node (or list of same), within the given scope. This assigns
+ * each definition a slot in its frame, and each reference either a frame
+ * depth and slot or (for a global) its box.
+ */
+void exnoResolve(zvalue node, Scope *scope);
+
+/**
+ * Resolves the body of the given `ClosureNode`, in a new scope nested
+ * within the given one. See `exnoResolve()`.
+ */
+void exnoResolveClosure(zvalue node, Scope *scope);
+
+/**
+ * Makes a function call (method `call`) in tail position, per the given
+ * converted `call` node. If `target` is a closure, the call is instead left
+ * pending in `tail`, and this returns `NULL`. Otherwise, this returns the
+ * result of the call, which must not be void unless `voidOk` is `true`.
+ */
+zvalue exnoTailCall(zvalue node, zvalue target, zarray args, bool voidOk,
+        TailCall *tail);
 
 /**
  * Given an `ExecNode`, returns the name of the variable it defines, if any.
@@ -109,32 +464,35 @@ void exnoExecuteStatements(zarray statements, Frame *frame);
 zvalue exnoVarDefName(zvalue node);
 
 /**
- * Initializes the given frame. The `frame` is assumed to live on the
- * C stack. The `parentFrame` if non-`NULL` must live on the heap.
+ * Defines a variable in the given frame, binding the given slot to the given
+ * box, or to the variable's value per se if it is unboxed (see `Scope`).
  */
-void frameInit(Frame *frame, Frame *parentFrame, zvalue parentClosure,
-    zvalue vars);
+void frameDef(zvalue frame, zint slot, zvalue box);
 
 /**
- * Does gc value marking.
+ * Fetches the box associated with a variable (or its value per se, if it is
+ * unboxed; see `Scope`). The variable is found at the given `slot` in the
+ * frame that is `depth` frames up from the given one.
  */
-void frameMark(Frame *frame);
+zvalue frameGet(zvalue frame, zint depth, zint slot);
 
 /**
- * Defines a new variable to the given frame, binding it to the given box.
+ * Gets the number of `zvalue`s of storage needed for a frame with the given
+ * number of slots, when made by `makeStackFrame()`.
  */
-void frameDef(Frame *frame, zvalue name, zvalue box);
+zint frameStackWords(zint size);
 
 /**
- * Fetches the box associated with a variable, out of the given frame. Fails
- * with a terminal error if `name` is not found.
+ * Makes a new frame, with the given parent frame and number of slots.
  */
-zvalue frameGet(Frame *frame, zvalue name);
+zvalue makeFrame(zvalue parentFrame, zint size);
 
 /**
- * Snapshots the given frame into the given target. The `target` is assumed
- * to be part of a heap-allocated structure.
+ * Like `makeFrame()`, but makes the frame in the given storage (sized per
+ * `frameStackWords()`), which is expected to be on the C stack or the VM
+ * stack (see `bcRun()`). This is only valid for frames that no closure will
+ * keep (see `Scope`).
  */
-void frameSnap(Frame *target, Frame *source);
+zvalue makeStackFrame(zvalue *storage, zvalue parentFrame, zint size);
 
 #endif
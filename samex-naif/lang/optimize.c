@@ -0,0 +1,940 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+//
+// Execution tree optimizer
+//
+// This is a tree-to-tree pass over simplified trees, done before they get
+// converted to `ExecNode`s (or compiled). Its result is an ordinary
+// execution tree, which evaluates to the same thing as the original did.
+// The only observable differences are in the details of how programs fail,
+// and in the identity of hoisted closures (see below): Each evaluation of
+// a hoisted `closure` node yields the closure that was built when its new
+// scope was entered, and so comparing two of them can find them to be the
+// same closure where the original tree would have built two.
+//
+// The transformations are:
+//
+// * Folding of method calls on literals of core immutable types, for
+//   methods that can neither fail nor have side effects.
+// * Propagation of immutable (`@result`) variables that are defined with a
+//   literal value.
+// * Static resolution of calls to `If.is`, `If.value`, and `If.or` whose
+//   tests are trivial literal closures, and inlining of trivial closures
+//   (no formals, statements, or `yieldDef`) that are called directly.
+// * Removal of unused `yieldDef`s, and of unused variable definitions whose
+//   values have no side effects.
+// * Hoisting of closure construction out of closures that are likely to be
+//   called repeatedly (such as loop bodies), when the closure being built
+//   doesn't refer to anything they define.
+//
+
+#include "langnode.h"
+#include "type/If.h"
+#include "type/Int.h"
+#include "type/List.h"
+#include "type/Map.h"
+#include "type/Record.h"
+#include "type/String.h"
+#include "type/Symbol.h"
+#include "type/SymbolTable.h"
+#include "util.h"
+
+#include "impl.h"
+
+
+//
+// Private Definitions
+//
+
+/** Growable list of nodes. */
+typedef struct {
+    /** The nodes. */
+    zvalue *elems;
+
+    /** Number of nodes. */
+    zint size;
+
+    /** Allocated size of `elems`. */
+    zint capacity;
+} NodeList;
+
+/** Variable, as tracked by the optimizer. */
+typedef struct {
+    /** Name of the variable. */
+    zvalue name;
+
+    /** Value of the variable, if immutable and known. Otherwise `NULL`. */
+    zvalue value;
+
+    /** Whether any reference to the variable has been kept. */
+    bool used;
+} OptVar;
+
+/**
+ * Lexical scope, used while optimizing. Names are defined in the same order
+ * that `exnoResolve()` will see them, so that references are always taken
+ * to refer to the same variables that they will when actually run.
+ */
+typedef struct OptScope {
+    /** Enclosing scope. `NULL` for the outermost scope. */
+    struct OptScope *parent;
+
+    /**
+     * Global variables, as a table from names to values. Only non-`NULL`
+     * for the outermost scope (and only if the environment is known).
+     */
+    zvalue globals;
+
+    /** Nesting depth. The outermost scope (globals) is `0`. */
+    zint depth;
+
+    /**
+     * Whether closures built in this scope may get built by the enclosing
+     * closure instead. This is `true` unless the closure isn't expected to be
+     * called more often than it gets built (for example, the branches of
+     * an `If.is`).
+     */
+    bool hoistOut;
+
+    /**
+     * Depth of the innermost scope outside of this one which has a variable
+     * referred to from within this one (including from nested closures).
+     * `0` if all such references are to globals.
+     */
+    zint reach;
+
+    /**
+     * Whether this scope contains nodes that the optimizer doesn't know
+     * about. If so, it's not safe to assume that a definition is unused
+     * just because no (known) reference to it has been seen.
+     */
+    bool opaque;
+
+    /** Variables defined so far. */
+    OptVar *vars;
+
+    /** Number of variables defined so far. */
+    zint size;
+
+    /** Allocated size of `vars`. */
+    zint capacity;
+
+    /**
+     * Definitions of closures hoisted into this scope, which are to be
+     * placed just before the statement currently being optimized.
+     */
+    NodeList hoisted;
+} OptScope;
+
+/** Number of closures hoisted so far, used to make unique names. */
+static zint hoistedCount = 0;
+
+// Defined below.
+static zvalue optimize(zvalue node, OptScope *scope, bool voidOk);
+static zvalue optClosure(zvalue node, OptScope *scope, bool hoistOut,
+    bool mayHoist);
+
+/**
+ * Adds a node to a list.
+ */
+static void nodesAdd(NodeList *list, zvalue node) {
+    if (list->size == list->capacity) {
+        zint newCapacity = (list->capacity == 0) ? 16 : list->capacity * 2;
+        zvalue *newElems = utilAlloc(newCapacity * sizeof(zvalue));
+
+        if (list->elems != NULL) {
+            utilCpy(zvalue, newElems, list->elems, list->size);
+            utilFree(list->elems);
+        }
+
+        list->elems = newElems;
+        list->capacity = newCapacity;
+    }
+
+    list->elems[list->size] = node;
+    list->size++;
+}
+
+/**
+ * Defines a variable in the given scope, with the given known value (or
+ * `NULL` if not known).
+ */
+static void define(OptScope *scope, zvalue name, zvalue value) {
+    if (scope->size == scope->capacity) {
+        zint newCapacity =
+            (scope->capacity == 0) ? 16 : scope->capacity * 2;
+        OptVar *newVars = utilAlloc(newCapacity * sizeof(OptVar));
+
+        if (scope->vars != NULL) {
+            utilCpy(OptVar, newVars, scope->vars, scope->size);
+            utilFree(scope->vars);
+        }
+
+        scope->vars = newVars;
+        scope->capacity = newCapacity;
+    }
+
+    scope->vars[scope->size] = (OptVar) {name, value, false};
+    scope->size++;
+}
+
+/**
+ * Defines whatever variables are defined by the given statement.
+ */
+static void defineFrom(OptScope *scope, zvalue node) {
+    if (nodeRecTypeIs(node, NODE_varDef)) {
+        zvalue value = (cm_get(node, SYM(box)) == SYM(result))
+            ? extractLiteral(cm_get(node, SYM(value)))
+            : NULL;
+        define(scope, cm_get(node, SYM(name)), value);
+    } else {
+        zarray names = zarrayFromList(get_definedNames(node));
+
+        for (zint i = 0; i < names.size; i++) {
+            define(scope, names.elems[i], NULL);
+        }
+    }
+}
+
+/**
+ * Finds the variable with the given name, as seen from the given scope.
+ * Returns the scope that defines it (the outermost scope, for globals), and
+ * stores its index in `*index` (`-1` for globals).
+ */
+static OptScope *findVar(OptScope *scope, zvalue name, zint *index) {
+    OptScope *s = scope;
+
+    // Search from the most recent definition backward, so that a
+    // redefinition shadows the original.
+    for (/*s*/; s->parent != NULL; s = s->parent) {
+        for (zint i = s->size - 1; i >= 0; i--) {
+            if (s->vars[i].name == name) {
+                *index = i;
+                return s;
+            }
+        }
+    }
+
+    *index = -1;
+    return s;
+}
+
+/**
+ * Notes that code in `scope` refers to a variable defined in `target`.
+ */
+static void noteRef(OptScope *scope, OptScope *target) {
+    for (OptScope *s = scope; s != target; s = s->parent) {
+        if (s->reach < target->depth) {
+            s->reach = target->depth;
+        }
+    }
+}
+
+/**
+ * Notes that `scope` contains a node which the optimizer doesn't know
+ * about. This makes sure that nothing gets hoisted out past it, and that no
+ * definitions get removed around it.
+ */
+static void notePinned(OptScope *scope) {
+    for (OptScope *s = scope; s->parent != NULL; s = s->parent) {
+        if (s->reach < (s->depth - 1)) {
+            s->reach = s->depth - 1;
+        }
+
+        s->opaque = true;
+    }
+}
+
+/**
+ * Resolves a reference to the named variable. If `fetchOnly` is `true` and
+ * the variable has a known value, returns that value; the reference will
+ * get replaced, so it doesn't count as a use. Otherwise, notes the use and
+ * returns `NULL`.
+ */
+static zvalue resolveRef(OptScope *scope, zvalue name, bool fetchOnly) {
+    zint index;
+    OptScope *s = findVar(scope, name, &index);
+
+    if (index >= 0) {
+        OptVar *var = &s->vars[index];
+
+        if (fetchOnly && (var->value != NULL)) {
+            return var->value;
+        }
+
+        var->used = true;
+    }
+
+    noteRef(scope, s);
+    return NULL;
+}
+
+/**
+ * Places the hoisted closure definitions of the given scope at the end of
+ * the given list of statements.
+ */
+static void placeHoisted(OptScope *scope, NodeList *statements) {
+    for (zint i = 0; i < scope->hoisted.size; i++) {
+        zvalue node = scope->hoisted.elems[i];
+
+        nodesAdd(statements, node);
+        define(scope, cm_get(node, SYM(name)), NULL);
+        scope->vars[scope->size - 1].used = true;
+    }
+
+    scope->hoisted.size = 0;
+}
+
+/**
+ * Makes a new variable name for a hoisted closure, one which is not
+ * already visible from the given scope.
+ */
+static zvalue hoistedName(OptScope *scope) {
+    for (;;) {
+        hoistedCount++;
+
+        char *str = utilFormat("<closure %d>", hoistedCount);
+        zvalue name = symbolFromUtf8(-1, str);
+        zint index;
+
+        utilFree(str);
+        findVar(scope, name, &index);
+
+        if (index < 0) {
+            return name;
+        }
+    }
+}
+
+/**
+ * Gets `node` with `key` bound to `value`, or `node` itself if that's
+ * already the case.
+ */
+static zvalue withBinding(zvalue node, zvalue key, zvalue value) {
+    return (cm_get(node, key) == value)
+        ? node
+        : cm_cat(node, symtabFromMapping((zmapping) {key, value}));
+}
+
+/**
+ * Indicates whether evaluating the given node is free of side effects and
+ * can't fail.
+ */
+static bool isPure(zvalue node) {
+    switch (nodeRecType(node)) {
+        case NODE_closure:
+        case NODE_literal:
+        case NODE_void: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/**
+ * Indicates whether the given node is a trivial closure, that is, one with
+ * no formals, no statements, and no `yieldDef`. Calling one of these with
+ * no arguments is the same as evaluating its `yield` in place.
+ */
+static bool isTrivialClosure(zvalue node) {
+    if (!nodeRecTypeIs(node, NODE_closure)) {
+        return false;
+    }
+
+    zvalue formals, statements, yield;
+    recGet3(node,
+        SYM(formals),    &formals,
+        SYM(statements), &statements,
+        SYM(yield),      &yield);
+
+    return (formals != NULL) && (get_size(formals) == 0)
+        && (statements != NULL) && (get_size(statements) == 0)
+        && (yield != NULL)
+        && (cm_get(node, SYM(yieldDef)) == NULL)
+        && (cm_get(node, SYM(info)) == NULL);
+}
+
+/**
+ * Indicates whether the given node is a trivial closure whose result is a
+ * literal (including void). If so, stores the result in `*value` (`NULL`
+ * for void).
+ */
+static bool literalYield(zvalue node, zvalue *value) {
+    if (!isTrivialClosure(node)) {
+        return false;
+    }
+
+    zvalue yield = cm_get(node, SYM(yield));
+
+    switch (nodeRecType(yield)) {
+        case NODE_literal: {
+            *value = cm_get(yield, SYM(value));
+            return true;
+        }
+        case NODE_void: {
+            *value = NULL;
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/**
+ * Gets the node to use in place of a no-argument call to the given
+ * function, if it's a trivial closure. `voidOk` indicates whether the call
+ * is in a context where void is allowed. Returns `NULL` if the call can't be
+ * inlined.
+ */
+static zvalue inlineCall(zvalue function, bool voidOk) {
+    if (!isTrivialClosure(function)) {
+        return NULL;
+    }
+
+    zvalue yield = cm_get(function, SYM(yield));
+
+    switch (nodeRecType(yield)) {
+        case NODE_maybe: {
+            return cm_get(yield, SYM(value));
+        }
+        case NODE_void: {
+            return voidOk ? yield : NULL;
+        }
+        default: {
+            return yield;
+        }
+    }
+}
+
+/**
+ * Makes a node to call the given function with the given list of arguments,
+ * inlining the call if possible.
+ */
+static zvalue callTo(zvalue function, zvalue args, bool voidOk) {
+    zvalue result = (get_size(args) == 0)
+        ? inlineCall(function, voidOk)
+        : NULL;
+
+    return (result != NULL) ? result : makeCall(function, SYMS(call), args);
+}
+
+/**
+ * Indicates whether the given (optimized) node is a reference to the class
+ * `If`.
+ */
+static bool isIfClass(zvalue node, OptScope *scope) {
+    switch (nodeRecType(node)) {
+        case NODE_literal: {
+            return cm_get(node, SYM(value)) == CLS_If;
+        }
+        case NODE_fetch: {
+            zvalue target = cm_get(node, SYM(target));
+
+            if (!nodeRecTypeIs(target, NODE_varRef)) {
+                return false;
+            }
+
+            zvalue name = cm_get(target, SYM(name));
+            zint index;
+            OptScope *s = findVar(scope, name, &index);
+
+            return (index < 0)
+                && (s->globals != NULL)
+                && (symtabGet(s->globals, name) == CLS_If);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/**
+ * Indicates whether all the given values have the given class.
+ */
+static bool allHaveClass(zarray values, zvalue cls) {
+    for (zint i = 0; i < values.size; i++) {
+        if (classOf(values.elems[i]) != cls) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Gets the result of calling the given method on the given target with the
+ * given arguments (all literal values), if that's a call that can be made
+ * ahead of time. That is, the call has to be on a core immutable type, can't
+ * have side effects, and can't fail. Returns `NULL` if the call can't be
+ * folded.
+ */
+static zvalue foldCall(zvalue target, zvalue name, zarray args) {
+    zvalue cls = classOf(target);
+
+    if (cls == CLS_Int) {
+        return intTryCall(target, name, args);
+    }
+
+    if (name == SYM(cat)) {
+        if (((cls == CLS_List) || (cls == CLS_Map) || (cls == CLS_String)
+                || (cls == CLS_SymbolTable))
+            && allHaveClass(args, cls)) {
+            return methCall(target, name, args);
+        }
+    } else if (name == SYM(new)) {
+        if (target == CLS_List) {
+            return methCall(target, name, args);
+        } else if (target == CLS_Map) {
+            if ((args.size & 1) == 0) {
+                return methCall(target, name, args);
+            }
+        } else if (target == CLS_SymbolTable) {
+            if ((args.size & 1) != 0) {
+                return NULL;
+            }
+
+            for (zint i = 0; i < args.size; i += 2) {
+                if (classOf(args.elems[i]) != CLS_Symbol) {
+                    return NULL;
+                }
+            }
+
+            return methCall(target, name, args);
+        } else if (target == CLS_Record) {
+            if ((args.size == 0) || (args.size > 2)
+                || (classOf(args.elems[0]) != CLS_Symbol)) {
+                return NULL;
+            }
+
+            if (args.size == 2) {
+                zvalue dataCls = classOf(args.elems[1]);
+                if ((dataCls != CLS_SymbolTable) && (dataCls != CLS_Record)) {
+                    return NULL;
+                }
+            }
+
+            return methCall(target, name, args);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Resolves a call to an `If` method statically, if possible. `args` are the
+ * (optimized) arguments, which originally were all closures. Returns the
+ * node to use instead, or `NULL` if the call has to be left as-is.
+ */
+static zvalue staticIf(zvalue target, zvalue name, zvalue method,
+        zarray args, bool voidOk) {
+    zvalue value;
+
+    if ((method == SYM(is)) || (method == SYM(value))) {
+        if ((args.size < 2) || (args.size > 3)
+            || !literalYield(args.elems[0], &value)) {
+            return NULL;
+        }
+
+        if (value != NULL) {
+            zvalue callArgs = (method == SYM(is))
+                ? EMPTY_LIST
+                : cm_new_List(makeLiteral(value));
+            return callTo(args.elems[1], callArgs, voidOk);
+        } else if (args.size == 3) {
+            return callTo(args.elems[2], EMPTY_LIST, voidOk);
+        }
+    } else if (method == SYM(or)) {
+        for (zint i = 0; i < args.size; i++) {
+            if (!literalYield(args.elems[i], &value)) {
+                if (i == 0) {
+                    return NULL;
+                }
+
+                // Drop the leading functions which always yield void.
+                zarray rest = {args.size - i, &args.elems[i]};
+                return (rest.size == 1)
+                    ? callTo(rest.elems[0], EMPTY_LIST, voidOk)
+                    : makeCall(target, name, listFromZarray(rest));
+            } else if (value != NULL) {
+                return makeLiteral(value);
+            }
+        }
+    } else {
+        return NULL;
+    }
+
+    // The call is known to yield void.
+    return voidOk ? TOK_void : NULL;
+}
+
+/**
+ * Optimizes a `call` node.
+ */
+static zvalue optCall(zvalue node, OptScope *scope, bool voidOk) {
+    zvalue target, name, values;
+    recGet3(node,
+        SYM(target), &target,
+        SYM(name),   &name,
+        SYM(values), &values);
+
+    zvalue method = extractLiteral(name);
+    zarray args = zarrayFromList(values);
+
+    if ((method == SYM(call)) && (args.size == 0)
+            && nodeRecTypeIs(target, NODE_closure)) {
+        // This is a direct call of a closure. Leave the closure in place
+        // (not hoisted), so that the call can possibly be inlined.
+        target = optClosure(target, scope, true, false);
+
+        zvalue result = inlineCall(target, voidOk);
+        if (result != NULL) {
+            return result;
+        }
+
+        return withBinding(node, SYM(target), target);
+    }
+
+    target = optimize(target, scope, false);
+    name = optimize(name, scope, false);
+
+    // Functions passed to `If` methods get called at most once, except for
+    // the looping ones.
+    bool ifCall = (method != NULL) && isIfClass(target, scope);
+    bool argsHoistOut =
+        !ifCall || (method == SYM(loop)) || (method == SYM(loopUntil));
+    bool allClosures = true;
+    bool allLiterals = true;
+    zvalue newArgs[args.size];
+
+    for (zint i = 0; i < args.size; i++) {
+        zvalue one = args.elems[i];
+
+        if (nodeRecTypeIs(one, NODE_closure)) {
+            one = optClosure(one, scope, argsHoistOut, true);
+        } else {
+            allClosures = false;
+            one = optimize(one, scope, false);
+        }
+
+        if (!nodeRecTypeIs(one, NODE_literal)) {
+            allLiterals = false;
+        }
+
+        newArgs[i] = one;
+    }
+
+    zarray newArr = {args.size, newArgs};
+
+    if (ifCall && allClosures) {
+        zvalue result = staticIf(target, name, method, newArr, voidOk);
+        if (result != NULL) {
+            return result;
+        }
+    }
+
+    if ((method != NULL) && allLiterals
+            && nodeRecTypeIs(target, NODE_literal)) {
+        zvalue argValues[args.size];
+
+        for (zint i = 0; i < args.size; i++) {
+            argValues[i] = extractLiteral(newArgs[i]);
+        }
+
+        zvalue result = foldCall(extractLiteral(target), method,
+            (zarray) {args.size, argValues});
+        if (result != NULL) {
+            return makeLiteral(result);
+        }
+    }
+
+    return cm_cat(node,
+        cm_new_SymbolTable(
+            SYM(name),   name,
+            SYM(target), target,
+            SYM(values), listFromZarray(newArr)));
+}
+
+/**
+ * Optimizes a statement of a closure body. Returns `NULL` if the statement
+ * can be dropped.
+ */
+static zvalue optStatement(zvalue node, OptScope *scope) {
+    switch (nodeRecType(node)) {
+        case NODE_importModule:
+        case NODE_importModuleSelection:
+        case NODE_importResource: {
+            return node;
+        }
+
+        case NODE_varDef: {
+            zvalue value = cm_get(node, SYM(value));
+            return withBinding(node, SYM(value),
+                optimize(value, scope, false));
+        }
+
+        default: {
+            zvalue result = optimize(node, scope, true);
+            return isPure(result) ? NULL : result;
+        }
+    }
+}
+
+/**
+ * Removes definitions of unused variables from the given list of
+ * statements, when the value of the definition has no side effects.
+ * `first` is the index of the first variable defined by a statement.
+ */
+static void removeDeadDefs(OptScope *scope, NodeList *statements,
+        zint first) {
+    zint at = first;
+    zint kept = 0;
+
+    for (zint i = 0; i < statements->size; i++) {
+        zvalue one = statements->elems[i];
+
+        if (nodeRecTypeIs(one, NODE_varDef)) {
+            bool used = scope->vars[at].used;
+            at++;
+
+            if (!used && isPure(cm_get(one, SYM(value)))) {
+                continue;
+            }
+        } else {
+            at += get_size(get_definedNames(one));
+        }
+
+        statements->elems[kept] = one;
+        kept++;
+    }
+
+    statements->size = kept;
+}
+
+/**
+ * Optimizes a `closure` node. `hoistOut` indicates whether closures built
+ * inside this one can get hoisted out of it. `mayHoist` indicates whether
+ * this closure itself can get hoisted out of the scope it's in.
+ */
+static zvalue optClosure(zvalue node, OptScope *scope, bool hoistOut,
+        bool mayHoist) {
+    zvalue formals, statements, yield, yieldDef;
+    recGet2(node,
+        SYM(formals),    &formals,
+        SYM(statements), &statements);
+    recGet2(node,
+        SYM(yield),    &yield,
+        SYM(yieldDef), &yieldDef);
+
+    OptScope inner = {
+        .parent = scope,
+        .depth = scope->depth + 1,
+        .hoistOut = hoistOut
+    };
+    NodeList body = {0};
+
+    // The formals and `yieldDef` are defined first, in the same order that
+    // `exnoResolveClosure()` defines them.
+
+    zarray formalsArr = zarrayFromList(formals);
+    for (zint i = 0; i < formalsArr.size; i++) {
+        zvalue name = cm_get(formalsArr.elems[i], SYM(name));
+        if (name != NULL) {
+            define(&inner, name, NULL);
+        }
+    }
+
+    zint exitIndex = -1;
+    if (yieldDef != NULL) {
+        exitIndex = inner.size;
+        define(&inner, yieldDef, NULL);
+    }
+
+    zint first = inner.size;
+    zarray statementsArr = zarrayFromList(statements);
+
+    for (zint i = 0; i < statementsArr.size; i++) {
+        zvalue one = optStatement(statementsArr.elems[i], &inner);
+
+        placeHoisted(&inner, &body);
+
+        if (one != NULL) {
+            nodesAdd(&body, one);
+            defineFrom(&inner, one);
+        }
+    }
+
+    if (yield != NULL) {
+        yield = optimize(yield, &inner, false);
+        placeHoisted(&inner, &body);
+    }
+
+    if (!inner.opaque) {
+        removeDeadDefs(&inner, &body, first);
+    }
+
+    zvalue result = cm_cat(node,
+        symtabFromMapping((zmapping) {
+            SYM(statements),
+            listFromZarray((zarray) {body.size, body.elems})}));
+
+    if (yield != NULL) {
+        result = withBinding(result, SYM(yield), yield);
+    }
+
+    if ((exitIndex >= 0) && !inner.vars[exitIndex].used && !inner.opaque) {
+        result = METH_CALL(result, del, SYM(yieldDef));
+    }
+
+    utilFree(inner.vars);
+    utilFree(inner.hoisted.elems);
+    utilFree(body.elems);
+
+    // A closure that only refers to globals (`reach == 0`) is already
+    // built just once, by `exnoEvalClosure()`, so it's left in place.
+    // Otherwise, find the outermost scope that it can be built in.
+
+    if (!mayHoist || (inner.reach == 0)) {
+        return result;
+    }
+
+    OptScope *landing = scope;
+    while (landing->hoistOut
+            && (landing->depth >= 2)
+            && (inner.reach < landing->depth)) {
+        landing = landing->parent;
+    }
+
+    if (landing == scope) {
+        return result;
+    }
+
+    zvalue name = hoistedName(scope);
+    nodesAdd(&landing->hoisted, makeVarDef(name, SYM(result), result));
+    noteRef(scope, landing);
+
+    return makeVarFetch(name);
+}
+
+/**
+ * Optimizes an arbitrary node. `voidOk` indicates whether the node is in a
+ * context where it is allowed to evaluate to void.
+ */
+static zvalue optimize(zvalue node, OptScope *scope, bool voidOk) {
+    switch (nodeRecType(node)) {
+        case NODE_apply: {
+            zvalue target, name, values;
+            recGet3(node,
+                SYM(target), &target,
+                SYM(name),   &name,
+                SYM(values), &values);
+
+            if (nodeRecTypeIs(values, NODE_void)) {
+                // This is how a call with no arguments comes out of
+                // simplification. Treat it as the equivalent `call`, so
+                // that it can get folded.
+                return optCall(makeCall(target, name, EMPTY_LIST),
+                    scope, voidOk);
+            }
+
+            target = optimize(target, scope, false);
+            name = optimize(name, scope, false);
+            values = optimize(values, scope, false);
+
+            return cm_cat(node,
+                cm_new_SymbolTable(
+                    SYM(name),   name,
+                    SYM(target), target,
+                    SYM(values), values));
+        }
+
+        case NODE_call: {
+            return optCall(node, scope, voidOk);
+        }
+
+        case NODE_closure: {
+            return optClosure(node, scope, true, true);
+        }
+
+        case NODE_fetch: {
+            zvalue target = cm_get(node, SYM(target));
+
+            if (nodeRecTypeIs(target, NODE_varRef)) {
+                zvalue value =
+                    resolveRef(scope, cm_get(target, SYM(name)), true);
+                return (value == NULL) ? node : makeLiteral(value);
+            }
+
+            return withBinding(node, SYM(target),
+                optimize(target, scope, false));
+        }
+
+        case NODE_literal:
+        case NODE_void: {
+            return node;
+        }
+
+        case NODE_maybe: {
+            zvalue value = optimize(cm_get(node, SYM(value)), scope, true);
+
+            switch (nodeRecType(value)) {
+                case NODE_literal:
+                case NODE_void: {
+                    return value;
+                }
+                default: {
+                    return withBinding(node, SYM(value), value);
+                }
+            }
+        }
+
+        case NODE_noYield: {
+            zvalue value = cm_get(node, SYM(value));
+            return withBinding(node, SYM(value),
+                optimize(value, scope, false));
+        }
+
+        case NODE_store: {
+            zvalue target, value;
+            recGet2(node,
+                SYM(target), &target,
+                SYM(value),  &value);
+
+            target = optimize(target, scope, false);
+            value = optimize(value, scope, false);
+
+            return cm_cat(node,
+                cm_new_SymbolTable(
+                    SYM(target), target,
+                    SYM(value),  value));
+        }
+
+        case NODE_varRef: {
+            resolveRef(scope, cm_get(node, SYM(name)), false);
+            return node;
+        }
+
+        default: {
+            // Not something the optimizer knows how to handle. Leave it
+            // as-is.
+            notePinned(scope);
+            return node;
+        }
+    }
+}
+
+
+//
+// Exported Definitions
+//
+
+// Documented in header.
+zvalue langOptimize0(zvalue env, zvalue node) {
+    OptScope globalScope = {.globals = env};
+
+    return optimize(node, &globalScope, false);
+}
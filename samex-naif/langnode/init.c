@@ -8,6 +8,33 @@
 
 #include "langnode.h"
 #include "type/Class.h"
+#include "util.h"
+
+
+//
+// Private Definitions
+//
+
+/**
+ * Maps the symbol with the given index to the given type, growing
+ * `nodeSymbolMap` if necessary.
+ */
+static void mapSymbol(zint index, znodeType type) {
+    if (index >= nodeSymbolMapSize) {
+        zint newSize = index + 1;
+        znodeType *newMap = utilAlloc(newSize * sizeof(znodeType));
+
+        if (nodeSymbolMap != NULL) {
+            utilCpy(znodeType, newMap, nodeSymbolMap, nodeSymbolMapSize);
+            utilFree(nodeSymbolMap);
+        }
+
+        nodeSymbolMap = newMap;
+        nodeSymbolMapSize = newSize;
+    }
+
+    nodeSymbolMap[index] = type;
+}
 
 
 //
@@ -15,7 +42,13 @@
 //
 
 // Documented in header.
-znodeType nodeSymbolMap[DAT_MAX_SYMBOLS];
+znodeType *nodeSymbolMap = NULL;
+
+// Documented in header.
+zint nodeSymbolMapSize = 0;
+
+// This provides the non-inline version of this function.
+extern znodeType nodeIndexType(zint index);
 
 // This provides the non-inline version of this function.
 extern znodeType nodeRecType(zvalue record);
@@ -31,9 +64,7 @@ MOD_INIT(langnode) {
     MOD_USE(cls);
     MOD_USE(lang_consts);
 
-    utilZero(nodeSymbolMap);
-
-    #define SYM_MAP(name) nodeSymbolMap[SYMIDX(name)] = NODE_##name;
+    #define SYM_MAP(name) mapSymbol(SYMIDX(name), NODE_##name);
 
     SYM_MAP(CH_PLUS);
     SYM_MAP(CH_QMARK);
@@ -14,17 +14,25 @@
 
 // Documented in spec.
 FUN_IMPL_DECL(Code_eval) {
-    zvalue env = args.elems[0];
-    zvalue expressionNode = args.elems[1];
+    zvalue env = first;
+    zvalue expressionNode = rest.elems[0];
 
     return langEval0(env, expressionNode);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Code_evalBinary) {
-    zvalue env = args.elems[0];
-    zvalue path = args.elems[1];
+    zvalue env = first;
+    zvalue path = rest.elems[0];
 
     ioCheckAbsolutePath(path);
     return datEvalBinary(env, path);
 }
+
+// Documented in spec.
+FUN_IMPL_DECL(Code_optimize) {
+    zvalue env = first;
+    zvalue expressionNode = rest.elems[0];
+
+    return langOptimize0(env, expressionNode);
+}
@@ -2,6 +2,14 @@
 // Licensed AS IS and WITHOUT WARRANTY under the Apache License,
 // Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
 
+// Needed for `lstat()` when using glibc.
+#define _XOPEN_SOURCE 700
+
+#include <dirent.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include "impl.h"
 #include "io.h"
 #include "lang.h"
@@ -97,7 +105,8 @@ static zvalue loadFile(zvalue path) {
             // We found a source text file.
             zvalue text = ioReadFileUtf8(srcPath);
             zvalue tree = langSimplify0(langParseProgram0(text), NULL);
-            func = langEval0(PRIMITIVE_ENVIRONMENT, tree);
+            func = langEval0(PRIMITIVE_ENVIRONMENT,
+                langOptimize0(PRIMITIVE_ENVIRONMENT, tree));
         } else {
             die("Missing bootstrap library file: %s", cm_debugString(path));
         }
@@ -106,6 +115,56 @@ static zvalue loadFile(zvalue path) {
     return FUN_CALL(func);
 }
 
+/**
+ * Computes a stamp for all the files in the given directory (recursively),
+ * based on their names, sizes, and modification times. `prefix` is the
+ * name to use for the directory itself. This sticks to plain C, so that it
+ * has no effect on the heap.
+ */
+static zint directoryStamp(const char *path, const char *prefix) {
+    DIR *dir = opendir(path);
+    uint64_t result = 0;
+
+    if (dir == NULL) {
+        return 0;
+    }
+
+    for (;;) {
+        struct dirent *entry = readdir(dir);
+
+        if (entry == NULL) {
+            break;
+        } else if ((strcmp(entry->d_name, ".") == 0)
+                || (strcmp(entry->d_name, "..") == 0)) {
+            continue;
+        }
+
+        char *subPath = utilFormat("%s/%s", path, entry->d_name);
+        char *subPrefix = utilFormat("%s/%s", prefix, entry->d_name);
+        struct stat st;
+
+        if (lstat(subPath, &st) == 0) {
+            zint info[2] = { st.st_size, st.st_mtime };
+            zint one = utilHash(0, subPrefix, strlen(subPrefix));
+            one = utilHash(one, info, sizeof(info));
+
+            if (S_ISDIR(st.st_mode)) {
+                zint sub = directoryStamp(subPath, subPrefix);
+                one = utilHash(one, &sub, sizeof(sub));
+            }
+
+            // Summing makes the result independent of directory order.
+            result += (uint64_t) one;
+        }
+
+        utilFree(subPath);
+        utilFree(subPrefix);
+    }
+
+    closedir(dir);
+    return (zint) result;
+}
+
 /**
  * Returns a map with all the core library bindings. This is the
  * return value from loading the top-level in-language library file `main`
@@ -139,11 +198,30 @@ static zvalue getLibrary(zvalue libraryPath) {
 //
 
 // Documented in header.
-zvalue libNewEnvironment(const char *libraryPath) {
+zvalue libNewEnvironment(const char *libraryPath, const char *imagePath) {
     MOD_USE(lib);
 
     zstackPointer save = datFrameStart();
-    zvalue result = getLibrary(stringFromUtf8(-1, libraryPath));
+    zvalue result = NULL;
+    zint stamp = 0;
+
+    if (imagePath != NULL) {
+        datImageBase();
+        stamp = directoryStamp(libraryPath, "");
+        result = datImageLoad(imagePath, stamp);
+    }
+
+    if (result == NULL) {
+        result = getLibrary(stringFromUtf8(-1, libraryPath));
+
+        if (imagePath != NULL) {
+            // Collect first, so that the image only contains the library's
+            // live values. Failing to save isn't an error; it just means
+            // the next run will have to load the library from scratch too.
+            datGc();
+            datImageSave(imagePath, stamp, result);
+        }
+    }
 
     datFrameReturn(save, result);
 
@@ -18,27 +18,27 @@ FUN_IMPL_DECL(Io0_cwd) {
 
 // Documented in spec.
 FUN_IMPL_DECL(Io0_fileType) {
-    zvalue path = args.elems[0];
+    zvalue path = first;
     return ioFileType(path, true);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Io0_readDirectory) {
-    return ioReadDirectory(args.elems[0]);
+    return ioReadDirectory(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Io0_readFileUtf8) {
-    return ioReadFileUtf8(args.elems[0]);
+    return ioReadFileUtf8(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Io0_readLink) {
-    return ioReadLink(args.elems[0]);
+    return ioReadLink(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Io0_writeFileUtf8) {
-    ioWriteFileUtf8(args.elems[0], args.elems[1]);
+    ioWriteFileUtf8(first, rest.elems[0]);
     return NULL;
 }
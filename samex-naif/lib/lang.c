@@ -13,25 +13,25 @@
 
 // Documented in spec.
 FUN_IMPL_DECL(Lang0_languageOf) {
-    return langLanguageOf0(args.elems[0]);
+    return langLanguageOf0(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Lang0_parseExpression) {
-    return langParseExpression0(args.elems[0]);
+    return langParseExpression0(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Lang0_parseProgram) {
-    return langParseProgram0(args.elems[0]);
+    return langParseProgram0(first);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Lang0_simplify) {
-    return langSimplify0(args.elems[0], args.elems[1]);
+    return langSimplify0(first, rest.elems[0]);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(Lang0_tokenize) {
-    return langTokenize0(args.elems[0]);
+    return langTokenize0(first);
 }
@@ -13,42 +13,44 @@
 //
 
 /**
- * Concatenates all the arguments into a unified string, returning that
+ * Concatenates all the arguments (`first` followed by `rest`, per the
+ * `zfunction` calling convention) into a unified string, returning that
  * string. It must be freed with `utilFree()` when done.
  */
-static char *unifiedString(zarray args, const char *ifNone) {
-    if (args.size == 0) {
+static char *unifiedString(zvalue first, zarray rest, const char *ifNone) {
+    if (first == NULL) {
         return utilStrdup((ifNone == NULL) ? "" : ifNone);
     }
 
     zint size = 1;  // Starts at 1, to count the terminal null byte.
-    for (zint i = 0; i < args.size; i++) {
-        size += utf8SizeFromString(args.elems[i]);
+    size += utf8SizeFromString(first);
+    for (zint i = 0; i < rest.size; i++) {
+        size += utf8SizeFromString(rest.elems[i]);
     }
 
     char *result = utilAlloc(size);
-    for (zint i = 0, at = 0; i < args.size; i++) {
-        at += utf8FromString(size - at, &result[at], args.elems[i]);
+    zint at = utf8FromString(size, result, first) - 1;
+    for (zint i = 0; i < rest.size; i++) {
+        at += utf8FromString(size - at, &result[at], rest.elems[i]);
         at--;  // Back up over the terminal null byte.
     }
 
     return result;
 }
 
-
 //
 // Exported Definitions
 //
 
 // Documented in spec.
 FUN_IMPL_DECL(die) {
-    char *str = unifiedString(args, "Alas.");
+    char *str = unifiedString(first, rest, "Alas.");
     die("%s", str);
 }
 
 // Documented in spec.
 FUN_IMPL_DECL(note) {
-    char *str = unifiedString(args, NULL);
+    char *str = unifiedString(first, rest, NULL);
 
     note("%s", str);
     utilFree(str);
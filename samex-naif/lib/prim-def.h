@@ -50,6 +50,7 @@ PRIM_DEF(Generator_stdFetch,      FUN_Generator_stdFetch);
 PRIM_DEF(Generator_stdForEach,    FUN_Generator_stdForEach);
 PRIM_FUNC(Code_eval,              2, 2);
 PRIM_FUNC(Code_evalBinary,        2, 2);
+PRIM_FUNC(Code_optimize,          2, 2);
 PRIM_FUNC(Io0_cwd,                0, 0);
 PRIM_FUNC(Io0_fileType,           1, 1);
 PRIM_FUNC(Io0_readDirectory,      1, 1);
@@ -2,8 +2,12 @@
 // Licensed AS IS and WITHOUT WARRANTY under the Apache License,
 // Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "lang.h"
 #include "lib.h"
 #include "type/Int.h"
 #include "type/List.h"
@@ -14,6 +18,134 @@
 #include "impl.h"
 
 
+//
+// Private Definitions
+//
+
+/**
+ * Parses a byte size given as the value of the environment variable with the
+ * given name. The size may have a `k`, `m`, or `g` suffix (either case), to
+ * indicate kibibytes, mebibytes, or gibibytes. Returns `-1` if the variable
+ * isn't set.
+ */
+static zint sizeFromEnv(const char *name) {
+    const char *str = getenv(name);
+
+    if ((str == NULL) || (*str == '\0')) {
+        return -1;
+    }
+
+    char *end;
+    long long result = strtoll(str, &end, 10);
+    zint multiplier = 1;
+
+    switch (*end) {
+        case 'k': case 'K': { multiplier = 1024;               end++; break; }
+        case 'm': case 'M': { multiplier = 1024 * 1024;        end++; break; }
+        case 'g': case 'G': { multiplier = 1024 * 1024 * 1024; end++; break; }
+    }
+
+    if ((end == str) || (*end != '\0') || (result < 0)) {
+        die("Invalid value for `%s`: %s", name, str);
+    }
+
+    // Checked before multiplying, since signed overflow is undefined. This
+    // also catches values that `strtoll()` clamped to its maximum.
+    if ((result == LLONG_MAX) || (result > (INT64_MAX / multiplier))) {
+        die("Value too large for `%s`: %s", name, str);
+    }
+
+    return (zint) (result * multiplier);
+}
+
+/**
+ * Sets up gc tuning based on environment variables, if set:
+ *
+ * * `SAMEX_GC_GROWTH`: heap growth factor, e.g. `1.5`.
+ * * `SAMEX_GC_MIN_HEAP`: minimum bytes allocated between gcs.
+ * * `SAMEX_GC_MAX_HEAP`: hard ceiling on the heap size.
+ * * `SAMEX_GC_THREADS`: number of threads to mark with, `0` for one per CPU.
+ * * `SAMEX_GC_INCREMENTAL`: `1` to do full gcs incrementally, `0` not to.
+ */
+static void configureGc(void) {
+    const char *growthStr = getenv("SAMEX_GC_GROWTH");
+    double growth = -1;
+
+    if ((growthStr != NULL) && (*growthStr != '\0')) {
+        char *end;
+        growth = strtod(growthStr, &end);
+
+        if ((end == growthStr) || (*end != '\0') || (growth < 1)) {
+            die("Invalid value for `SAMEX_GC_GROWTH`: %s", growthStr);
+        }
+    }
+
+    datGcConfigure(growth,
+        sizeFromEnv("SAMEX_GC_MIN_HEAP"),
+        sizeFromEnv("SAMEX_GC_MAX_HEAP"));
+
+    const char *threadsStr = getenv("SAMEX_GC_THREADS");
+
+    if ((threadsStr != NULL) && (*threadsStr != '\0')) {
+        char *end;
+        long long threads = strtoll(threadsStr, &end, 10);
+
+        if ((end == threadsStr) || (*end != '\0') || (threads < 0)) {
+            die("Invalid value for `SAMEX_GC_THREADS`: %s", threadsStr);
+        }
+
+        datGcSetMarkThreads(threads);
+    }
+
+    const char *incrementalStr = getenv("SAMEX_GC_INCREMENTAL");
+
+    if ((incrementalStr != NULL) && (*incrementalStr != '\0')) {
+        if (strcmp(incrementalStr, "1") == 0) {
+            datGcSetIncremental(true);
+        } else if (strcmp(incrementalStr, "0") == 0) {
+            datGcSetIncremental(false);
+        } else {
+            die("Invalid value for `SAMEX_GC_INCREMENTAL`: %s",
+                incrementalStr);
+        }
+    }
+}
+
+/**
+ * Gets the path to the core library heap image, based on the environment
+ * variable `SAMEX_IMAGE`. If not set, this defaults to `corelib.image` in the
+ * program directory. If set but empty, this returns `NULL`, meaning that no
+ * image is to be used. Non-`NULL` return values must be freed with
+ * `utilFree()`.
+ */
+static char *imagePathFromEnv(const char *argv0) {
+    const char *str = getenv("SAMEX_IMAGE");
+
+    if (str == NULL) {
+        return getProgramDirectory(argv0, "corelib.image");
+    } else if (*str == '\0') {
+        return NULL;
+    } else {
+        return utilStrdup(str);
+    }
+}
+
+/**
+ * Reports totals of inline method cache activity. This is set up to be
+ * called at exit when the environment variable `SAMEX_CALL_STATS` is `1`.
+ */
+static void reportCallStats(void) {
+    zcallCacheStats stats = methCallCacheStats();
+    zint hits = stats.monomorphicHits + stats.polymorphicHits;
+    zint total = hits + stats.misses + stats.megamorphicMisses;
+
+    note("Call stats: %d cached calls, %d hits (%d monomorphic, "
+        "%d polymorphic), %d misses, %d megamorphic misses.",
+        total, hits, stats.monomorphicHits, stats.polymorphicHits,
+        stats.misses, stats.megamorphicMisses);
+}
+
+
 //
 // Main program
 //
@@ -28,10 +160,24 @@ int main(int argc, char **argv) {
         die("Too few arguments.");
     }
 
+    configureGc();
+
+    const char *statsStr = getenv("SAMEX_CALL_STATS");
+    if ((statsStr != NULL) && (strcmp(statsStr, "1") == 0)) {
+        atexit(reportCallStats);
+    }
+
+    const char *bytecodeStr = getenv("SAMEX_BYTECODE");
+    if ((bytecodeStr != NULL) && (strcmp(bytecodeStr, "1") == 0)) {
+        langSetBytecode(true);
+    }
+
     char *libraryDir = getProgramDirectory(argv[0], "corelib");
-    zvalue env = libNewEnvironment(libraryDir);
+    char *imagePath = imagePathFromEnv(argv[0]);
+    zvalue env = libNewEnvironment(libraryDir, imagePath);
 
     utilFree(libraryDir);
+    utilFree(imagePath);
 
     // The arguments to `run` are the original command-line arguments (per se,
     // so not including C's `argv[0]`).
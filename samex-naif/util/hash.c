@@ -0,0 +1,36 @@
+// Copyright 2013-2015 the Samizdat Authors (Dan Bornstein et alia).
+// Licensed AS IS and WITHOUT WARRANTY under the Apache License,
+// Version 2.0. Details: <http://www.apache.org/licenses/LICENSE-2.0>
+
+#include <stdint.h>
+
+#include "util.h"
+
+
+//
+// Private Definitions
+//
+
+/** FNV-1a 64-bit offset basis. */
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/** FNV-1a 64-bit prime. */
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+
+//
+// Exported Definitions
+//
+
+// Documented in header.
+zint utilHash(zint seed, const void *data, zint size) {
+    const uint8_t *bytes = data;
+    uint64_t result = (seed == 0) ? FNV_OFFSET_BASIS : (uint64_t) seed;
+
+    for (zint i = 0; i < size; i++) {
+        result ^= bytes[i];
+        result *= FNV_PRIME;
+    }
+
+    return (result == 0) ? 1 : (zint) result;
+}
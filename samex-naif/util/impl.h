@@ -16,10 +16,7 @@ enum {
     UTIL_INITIAL_FORMAT_SIZE = 200,
 
     /** Maximum number of active stack frames. */
-    UTIL_MAX_CALL_STACK_DEPTH = 4000,
-
-    /** Maximum number of disjoint heap allocation page ranges. */
-    UTIL_MAX_PAGE_RANGES = 400
+    UTIL_MAX_CALL_STACK_DEPTH = 4000
 };
 
 #endif
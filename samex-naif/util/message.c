@@ -26,9 +26,21 @@ typedef struct Context {
 // Documented in header.
 UtilStackGiblet *utilStackTop = NULL;
 
+// Documented in header.
+ztraceFunction utilTraceFunction = NULL;
+
 /** Whether death is currently in progress. */
 static bool currentlyDying = false;
 
+/**
+ * Emits one line of stack context as part of a death report.
+ */
+static void emitContext(const char *line) {
+    fputs("    at ", stderr);
+    fputs(line, stderr);
+    fputs("\n", stderr);
+}
+
 
 //
 // Exported Definitions
@@ -57,13 +69,14 @@ void die(const char *format, ...) {
         UtilStackGiblet *stackPtr = utilStackTop;
         while ((stackPtr != NULL) && (stackPtr->magic == UTIL_GIBLET_MAGIC)) {
             if (stackPtr->function != NULL) {
-                char *message = stackPtr->function(stackPtr->state);
-                fputs("    at ", stderr);
-                fputs(message, stderr);
-                fputs("\n", stderr);
+                emitContext(stackPtr->function(stackPtr->state));
             }
             stackPtr = stackPtr->pop;
         }
+
+        if (utilTraceFunction != NULL) {
+            utilTraceFunction(emitContext);
+        }
     }
 
     exit(1);